@@ -5,6 +5,11 @@
 #include <limits> // Provides numeric_limits to validate user input.
 #include <vector> // Enables the use of dynamic arrays (vectors) for storing loan reasons.
 #include <iomanip> // Provides input/output manipulation.
+#include <fstream> // Provides file streams for spilling idle accounts to the on-disk segment.
+#include <cctype> // Provides tolower for case-insensitive name search.
+#include <cmath> // Provides sqrt and fabs for transaction amount statistics.
+#include <chrono> // Provides the millisecond wall clock behind transaction timestamps.
+#include <sstream> // Provides string streams for parsing protocol commands and formatting responses.
 
 using namespace std; 
 
@@ -20,7 +25,7 @@ public:
 
     void push(const string& element) { // Adds an element to the top of the stack.
         if (topIndex >= MAX_SIZE - 1) { // Checks for stack overflow.
-            cout << "Stack overflow, unable to push element." << endl; // Notifies user if stack is full.
+            cerr << "Stack overflow, unable to push element." << endl; // Notifies user if stack is full, without mixing into command protocol responses.
         } else {
             elements[++topIndex] = element; // Increments topIndex and adds the element to the stack.
         }
@@ -42,6 +47,18 @@ public:
     bool empty() const { // Checks if the stack is empty.
         return topIndex == -1; // Returns true if topIndex is -1, indicating an empty stack.
     }
+
+    int size() const { // Returns the number of elements in the stack.
+        return topIndex + 1; // topIndex is zero-based, so the count is one more.
+    }
+
+    const string& at(int index) const { // Returns the element at a position counted from the bottom of the stack, without copying it.
+        static const string none; // Returned for an out-of-range index.
+        if (index >= 0 && index <= topIndex) {
+            return elements[index]; // Returns the element if the index is in range.
+        }
+        return none; // Returns an empty string for an out-of-range index.
+    }
 };
 
 // Custom Queue Class
@@ -152,6 +169,10 @@ public:
         }
     }
 
+    LoanNode* getHead() const { // Returns the first loan node for callers that need to walk the list.
+        return head; // Returns the head pointer.
+    }
+
     ~LoanHistory() { // Destructor to free memory when the loan history is no longer needed.
         while (head) { // Loops until the loan history is empty.
             LoanNode* temp = head; // Temporarily stores the head node.
@@ -161,6 +182,56 @@ public:
     }
 };
 
+// Wall clock that never goes backwards, used for all transaction timestamps
+class BankClock {
+public:
+    static long long nowMillis() { // Returns milliseconds since the epoch, never less than an earlier call.
+        static long long lastMillis = 0; // Last value handed out.
+        long long now = chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count(); // Reads the system clock.
+        lastMillis = max(now, lastMillis); // A clock set backwards holds at the last value instead of running ahead of real time.
+        return lastMillis; // Returns the timestamp.
+    }
+};
+
+// Kinds of transactions recorded in the audit trail
+enum TransactionType {
+    TXN_ACCOUNT_OPENED, // Account created with its initial balance.
+    TXN_DEPOSIT, // Funds added to the balance.
+    TXN_WITHDRAW, // Funds taken from the balance.
+    TXN_LOAN_REQUESTED, // Loan approved and recorded on the account.
+    TXN_LOAN_CLEARED, // Loan removed from the account.
+    TXN_TYPE_COUNT // Number of transaction types.
+};
+
+const char* const TRANSACTION_TYPE_NAMES[TXN_TYPE_COUNT] = { // Names used in the audit log dictionary.
+    "Account opened", "Deposit", "Withdraw", "Loan requested", "Loan cleared"
+};
+
+// Structured transaction record kept for auditing and replay
+struct TransactionRecord {
+    long long timestamp; // Time of the transaction in milliseconds since the epoch.
+    double amount; // Amount of the transaction, or 0 if it has none.
+    unsigned char type; // TransactionType of the record.
+};
+
+// Running per-account statistics used by the fraud detector
+struct TransactionMonitorState {
+    static const int VELOCITY_SLOTS = 8; // Number of recent transaction times remembered.
+    long long recentTimes[VELOCITY_SLOTS]; // Ring buffer of recent transaction times in milliseconds.
+    int nextSlot; // Ring buffer position that receives the next time.
+    int recentCount; // Number of valid entries in the ring buffer.
+    long long transactionCount; // Number of transactions observed.
+    double amountMean; // Running mean of transaction amounts.
+    double amountM2; // Running sum of squared deviations from the mean (Welford's method).
+    long long lastTime; // Time of the previous transaction in milliseconds.
+    double meanGap; // Exponentially weighted average time between transactions in milliseconds.
+
+    TransactionMonitorState() : nextSlot(0), recentCount(0), transactionCount(0), amountMean(0.0), amountM2(0.0), lastTime(0), meanGap(0.0) { // Initializes an account with no history.
+        for (int i = 0; i < VELOCITY_SLOTS; ++i) recentTimes[i] = 0; // Clears the ring buffer.
+    }
+};
+const int TransactionMonitorState::VELOCITY_SLOTS; // Definition for uses that take the constant by reference, such as min().
+
 // Bank account class
 class Account {
 public:
@@ -174,21 +245,29 @@ public:
     bool loanPending; // Flag to indicate if a loan request is pending.
     LoanHistory loanHistory; // Object to manage loan history.
     time_t lastTransactionTime; // Timestamp of the last transaction.
+    TransactionMonitorState monitorState; // Running statistics for fraud and velocity checks.
+    vector<TransactionRecord> auditTrail; // Every transaction since the account was opened, for export and replay.
+    bool dirty; // Whether the account changed since it was last written to or read from disk.
 
-    Account() : accountNumber(0), balance(0.0), loanAmount(0.0), loanPending(false), lastTransactionTime(time(0)) {} // Default constructor initializes account with default values.
+    Account() : accountNumber(0), balance(0.0), loanAmount(0.0), loanPending(false), lastTransactionTime(time(0)), dirty(true) {} // Default constructor initializes account with default values.
 
     Account(int accountNumber, const string& customerName, double initialBalance, const string& password) // Parameterized constructor to initialize account with specific values.
         : accountNumber(accountNumber), customerName(customerName), balance(initialBalance),
           transactionHistory(), loanAmount(0.0), loanReason(""), password(password),
-          loanPending(false), lastTransactionTime(time(0)) {} // Initializes account details and sets last transaction time.
+          loanPending(false), lastTransactionTime(time(0)), dirty(true) { // Initializes account details and sets last transaction time.
+        addTransaction(TXN_ACCOUNT_OPENED, initialBalance, "Account opened with initial balance: " + to_string(initialBalance)); // Records the opening balance so replay starts from it.
+    }
 
     bool validatePassword(const string& enteredPassword) { // Validates the entered password against the stored password.
         return enteredPassword == password; // Returns true if passwords match.
     }
 
-    void addTransaction(const 
-    string& transaction) { // Adds a transaction to the transaction history.
-        lastTransactionTime += rand() % 60 + 1; // Updates the last transaction time with a random increment.
+    void addTransaction(TransactionType type, double amount, const string& transaction) { // Adds a transaction to the transaction history and audit trail.
+        long long timestamp = BankClock::nowMillis(); // Reads the real clock.
+        lastTransactionTime = static_cast<time_t>(timestamp / 1000); // Updates the last transaction time.
+        TransactionRecord record = { timestamp, amount, static_cast<unsigned char>(type) }; // Builds the structured record.
+        auditTrail.push_back(record); // Appends it to the audit trail.
+        dirty = true; // Every change to an account goes through a transaction, so the disk copy is now stale.
         char buffer[80]; // Buffer to hold the formatted time string.
         strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", localtime(&lastTransactionTime)); // Formats the time into a readable string.
         transactionHistory.push(string(buffer) + " - " + transaction); // Pushes the transaction with the timestamp onto the stack.
@@ -198,7 +277,7 @@ public:
         loanAmount = amount; // Sets the loan amount.
         loanReason = reason; // Sets the reason for the loan.
         loanPending = true; // Marks the loan as pending.
-        addTransaction("Loan requested: " + to_string(amount) + " for reason: " + reason); // Adds a transaction for the loan request.
+        addTransaction(TXN_LOAN_REQUESTED, amount, "Loan requested: " + to_string(amount) + " for reason: " + reason); // Adds a transaction for the loan request.
         loanHistory.addLoan(amount, reason, customerName, accountNumber); // Adds the loan details to the loan history.
     }
 
@@ -206,7 +285,7 @@ public:
         loanAmount = 0; // Resets the loan amount.
         loanReason = ""; // Clears the loan reason.
         loanPending = false; // Marks the loan as not pending.
-        addTransaction("Loan cleared."); // Adds a transaction for clearing the loan.
+        addTransaction(TXN_LOAN_CLEARED, 0, "Loan cleared."); // Adds a transaction for clearing the loan.
     }
 
     string getLoanDetails() const { // Retrieves the loan details.
@@ -233,39 +312,525 @@ public:
             }
         }
     }
+
+    size_t estimateMemoryUsage() const { // Estimates the bytes this account occupies while resident in memory.
+        size_t bytes = sizeof(Account) + customerName.capacity() + loanReason.capacity() + password.capacity(); // Fixed part plus owned strings.
+        for (int i = 0; i < transactionHistory.size(); ++i) { // Adds the text of every stored transaction.
+            bytes += transactionHistory.at(i).capacity(); // Adds the transaction string length.
+        }
+        for (LoanNode* loan = loanHistory.getHead(); loan; loan = loan->next) { // Adds every loan history record.
+            bytes += sizeof(LoanNode) + loan->reason.capacity() + loan->customerName.capacity(); // Adds the node and its strings.
+        }
+        bytes += auditTrail.capacity() * sizeof(TransactionRecord); // Adds the audit trail.
+        return bytes; // Returns the estimated size.
+    }
+
+    void writeTo(ostream& out) const { // Serializes the full account state as a binary record.
+        out.write(reinterpret_cast<const char*>(&accountNumber), sizeof(accountNumber)); // Writes the account number.
+        writeString(out, customerName); // Writes the customer name.
+        out.write(reinterpret_cast<const char*>(&balance), sizeof(balance)); // Writes the balance.
+        out.write(reinterpret_cast<const char*>(&loanAmount), sizeof(loanAmount)); // Writes the loan amount.
+        writeString(out, loanReason); // Writes the loan reason.
+        writeString(out, password); // Writes the password.
+        out.write(reinterpret_cast<const char*>(&loanPending), sizeof(loanPending)); // Writes the pending loan flag.
+        out.write(reinterpret_cast<const char*>(&lastTransactionTime), sizeof(lastTransactionTime)); // Writes the last transaction time.
+        out.write(reinterpret_cast<const char*>(&monitorState), sizeof(monitorState)); // Writes the fraud detector statistics.
+        int transactionCount = transactionHistory.size(); // Number of transactions to write.
+        out.write(reinterpret_cast<const char*>(&transactionCount), sizeof(transactionCount)); // Writes the transaction count.
+        for (int i = 0; i < transactionCount; ++i) { // Writes transactions from oldest to newest.
+            writeString(out, transactionHistory.at(i)); // Writes one transaction string.
+        }
+        int loanCount = 0; // Number of loan history records to write.
+        for (LoanNode* loan = loanHistory.getHead(); loan; loan = loan->next) loanCount++; // Counts the loan records.
+        out.write(reinterpret_cast<const char*>(&loanCount), sizeof(loanCount)); // Writes the loan count.
+        for (LoanNode* loan = loanHistory.getHead(); loan; loan = loan->next) { // Writes every loan record in order.
+            out.write(reinterpret_cast<const char*>(&loan->amount), sizeof(loan->amount)); // Writes the loan amount.
+            writeString(out, loan->reason); // Writes the loan reason.
+        }
+        size_t recordCount = auditTrail.size(); // Number of audit records to write.
+        out.write(reinterpret_cast<const char*>(&recordCount), sizeof(recordCount)); // Writes the audit record count.
+        if (recordCount > 0) { // Writes the audit records in one block.
+            out.write(reinterpret_cast<const char*>(&auditTrail[0]), recordCount * sizeof(TransactionRecord));
+        }
+    }
+
+    void readFrom(istream& in) { // Restores the full account state from a record written by writeTo.
+        in.read(reinterpret_cast<char*>(&accountNumber), sizeof(accountNumber)); // Reads the account number.
+        customerName = readString(in); // Reads the customer name.
+        in.read(reinterpret_cast<char*>(&balance), sizeof(balance)); // Reads the balance.
+        in.read(reinterpret_cast<char*>(&loanAmount), sizeof(loanAmount)); // Reads the loan amount.
+        loanReason = readString(in); // Reads the loan reason.
+        password = readString(in); // Reads the password.
+        in.read(reinterpret_cast<char*>(&loanPending), sizeof(loanPending)); // Reads the pending loan flag.
+        in.read(reinterpret_cast<char*>(&lastTransactionTime), sizeof(lastTransactionTime)); // Reads the last transaction time.
+        in.read(reinterpret_cast<char*>(&monitorState), sizeof(monitorState)); // Reads the fraud detector statistics.
+        int transactionCount = 0; // Number of transactions stored in the record.
+        in.read(reinterpret_cast<char*>(&transactionCount), sizeof(transactionCount)); // Reads the transaction count.
+        for (int i = 0; i < transactionCount && in; ++i) { // Reads transactions from oldest to newest.
+            transactionHistory.push(readString(in)); // Pushes each transaction back onto the stack.
+        }
+        int loanCount = 0; // Number of loan records stored in the record.
+        in.read(reinterpret_cast<char*>(&loanCount), sizeof(loanCount)); // Reads the loan count.
+        for (int i = 0; i < loanCount && in; ++i) { // Reads every loan record in order.
+            double amount = 0; // Loan amount of this record.
+            in.read(reinterpret_cast<char*>(&amount), sizeof(amount)); // Reads the loan amount.
+            string reason = readString(in); // Reads the loan reason.
+            loanHistory.addLoan(amount, reason, customerName, accountNumber); // Rebuilds the loan history node.
+        }
+        size_t recordCount = 0; // Number of audit records stored in the record.
+        in.read(reinterpret_cast<char*>(&recordCount), sizeof(recordCount)); // Reads the audit record count.
+        if (in && recordCount > 0) { // Reads the audit records in one block.
+            auditTrail.resize(recordCount);
+            in.read(reinterpret_cast<char*>(&auditTrail[0]), recordCount * sizeof(TransactionRecord));
+        }
+        if (!in) { // Checks that the whole record was read.
+            throw runtime_error("Failed to read account record from disk"); // Reports a truncated or corrupt record.
+        }
+        dirty = false; // The account matches the record it was read from.
+    }
+
+private:
+    static void writeString(ostream& out, const string& value) { // Writes a length-prefixed string.
+        size_t length = value.size(); // Length of the string.
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length)); // Writes the length prefix.
+        out.write(value.data(), length); // Writes the characters.
+    }
+
+    static string readString(istream& in) { // Reads a length-prefixed string written by writeString.
+        size_t length = 0; // Length of the string.
+        in.read(reinterpret_cast<char*>(&length), sizeof(length)); // Reads the length prefix.
+        if (!in) return ""; // Returns an empty string if the prefix could not be read.
+        string value(length, '\0'); // Allocates the string.
+        in.read(&value[0], length); // Reads the characters.
+        return value; // Returns the string.
+    }
 };
 
 // Binary tree node for storing accounts
 class AccountNode {
 public:
-    Account* account; // Pointer to the account object.
+    int accountNumber; // Account number kept in the node so the tree can be searched while the account is on disk.
+    string customerName; // Customer name kept in the node so name lookups do not need the account in memory.
+    Account* account; // Pointer to the account object, or nullptr while the account is evicted to disk.
+    streamoff diskOffset; // Offset of the account's latest record in the disk segment, -1 if never evicted.
+    streamoff diskBytes; // Length of the account's latest record in the disk segment.
+    size_t residentBytes; // Estimated memory charged to the budget while the account is resident.
     AccountNode* left; // Pointer to the left child node.
     AccountNode* right; // Pointer to the right child node.
+    AccountNode* lruPrev; // Previous (more recently used) node in the residency list.
+    AccountNode* lruNext; // Next (less recently used) node in the residency list.
+
+    AccountNode(Account* acc) // Constructor initializes the account node with a pointer to an account.
+        : accountNumber(acc->accountNumber), customerName(acc->customerName), account(acc), diskOffset(-1),
+          diskBytes(0), residentBytes(0), left(nullptr), right(nullptr), lruPrev(nullptr), lruNext(nullptr) {} // Copies the lookup keys and clears all links.
+};
+
+const streamoff SEGMENT_COMPACTION_MIN = 1024 * 1024; // Segment size below which stale records are not worth compacting.
+
+bool fileExists(const string& path) { // Checks whether a file can be opened, so existing files are never overwritten.
+    ifstream existing(path.c_str()); // Tries to open the file.
+    return static_cast<bool>(existing); // Opened means it exists.
+}
+
+// Tiered account store keeping recently used accounts in memory and spilling idle ones to disk
+class TieredAccountStore {
+private:
+    AccountNode* lruHead; // Most recently used resident account.
+    AccountNode* lruTail; // Least recently used resident account, the first eviction candidate.
+    Account* pinnedAccount; // Account that must stay resident (the logged-in user).
+    size_t memoryBudget; // Maximum estimated bytes of resident accounts.
+    size_t residentBytes; // Estimated bytes of all resident accounts.
+    int residentCount; // Number of accounts currently in memory.
+    int evictedCount; // Number of accounts currently on disk.
+    long long hits; // Lookups served from memory.
+    long long misses; // Lookups that had to load the account from disk.
+    string basePath; // Segment file name requested at startup.
+    string segmentPath; // Path of the current segment file, which switches between basePath and basePath + ".compact" on each compaction.
+    fstream segment; // Append-only file holding evicted account records.
+    bool ownsSegment; // Whether this run created the segment file and must remove it.
+    bool spillEnabled; // Cleared if the segment cannot be opened or written, keeping every account in memory.
+    vector<AccountNode*> nodes; // Every account node, so compaction can find all live records.
+    streamoff segmentBytes; // Current length of the segment file.
+    streamoff liveBytes; // Bytes of the segment still referenced by an account node.
+
+    void disableSpilling(const string& reason) { // Stops using the disk and keeps all accounts in memory.
+        cerr << "Warning: " << reason << "; idle accounts will stay in memory.\n"; // Tells the operator why.
+        spillEnabled = false; // No further evictions.
+    }
+
+    bool writeRecord(AccountNode* node) { // Appends an account's current state to the segment.
+        segment.clear(); // Clears any end-of-file state left by an earlier read.
+        segment.seekp(0, ios::end); // Records are always appended.
+        streamoff offset = segment.tellp(); // Where the record starts.
+        node->account->writeTo(segment); // Writes the full account state.
+        segment.flush(); // Makes sure the record is on disk before the memory is freed.
+        if (!segment) return false; // The write failed.
+        if (node->diskOffset >= 0) liveBytes -= node->diskBytes; // The previous record is now garbage.
+        node->diskOffset = offset; // Remembers the new record.
+        node->diskBytes = static_cast<streamoff>(segment.tellp()) - offset;
+        segmentBytes = offset + node->diskBytes; // The segment grew by the record.
+        liveBytes += node->diskBytes; // The new record is live.
+        node->account->dirty = false; // The disk copy is current.
+        return true; // The record was written.
+    }
+
+    bool readRecord(AccountNode* node, Account& acc) { // Reads an evicted account's latest record; reports and returns false on failure.
+        segment.clear(); // Clears any end-of-file state.
+        segment.seekg(node->diskOffset); // Moves to the account's latest record.
+        try {
+            acc.readFrom(segment); // Restores the account state.
+            return true;
+        } catch (const exception& e) { // Also covers allocation failures on a damaged record.
+            cerr << "Warning: account " << node->accountNumber << " is unavailable: " << e.what() << ".\n"; // Tells the operator.
+            segment.clear(); // Leaves the segment usable for other records.
+            return false;
+        }
+    }
+
+    void compact() { // Rewrites the segment keeping only the latest record of each account.
+        string compactPath = segmentPath == basePath ? basePath + ".compact" : basePath; // The compacted segment goes to the other file name.
+        if (fileExists(compactPath)) return; // Never overwrites a file this run did not create.
+        fstream out(compactPath.c_str(), ios::in | ios::out | ios::binary | ios::trunc); // Opens the new segment.
+        vector<char> buffer; // Holds one record while it is copied.
+        streamoff offset = 0; // Write position in the compacted segment.
+        vector<streamoff> newOffsets(nodes.size(), -1); // New record positions, applied only if the copy succeeds.
+        for (size_t i = 0; i < nodes.size() && out; ++i) { // Copies every live record.
+            if (nodes[i]->diskOffset < 0) continue; // The account has never been written.
+            buffer.resize(static_cast<size_t>(nodes[i]->diskBytes)); // Makes room for the record.
+            segment.clear(); // Clears any end-of-file state.
+            segment.seekg(nodes[i]->diskOffset); // Moves to the record.
+            if (!segment.read(&buffer[0], buffer.size())) break; // Stops if the record cannot be read.
+            out.write(&buffer[0], buffer.size()); // Copies the record.
+            newOffsets[i] = offset; // Remembers its new position.
+            offset += nodes[i]->diskBytes;
+        }
+        out.flush(); // Makes sure the copied records are on disk.
+        if (!out || !segment) { // Keeps the old segment if anything failed.
+            out.close();
+            remove(compactPath.c_str());
+            segment.clear();
+            return;
+        }
+        segment.close(); // The old segment is released only once the new one is open and complete.
+        remove(segmentPath.c_str());
+        segment.swap(out); // The new segment takes over.
+        segmentPath = compactPath;
+        for (size_t i = 0; i < nodes.size(); ++i) { // Points every node at its copied record.
+            if (nodes[i]->diskOffset >= 0) nodes[i]->diskOffset = newOffsets[i];
+        }
+        segmentBytes = liveBytes = offset; // Everything left is live.
+    }
 
-    AccountNode(Account* acc) : account(acc), left(nullptr), right(nullptr) {} // Constructor initializes the account node with a pointer to an account.
+    void unlink(AccountNode* node) { // Removes a node from the residency list.
+        if (node->lruPrev) node->lruPrev->lruNext = node->lruNext; // Bypasses the node going forward.
+        else lruHead = node->lruNext; // The node was the head.
+        if (node->lruNext) node->lruNext->lruPrev = node->lruPrev; // Bypasses the node going backward.
+        else lruTail = node->lruPrev; // The node was the tail.
+        node->lruPrev = node->lruNext = nullptr; // Clears the node's own links.
+    }
+
+    void pushFront(AccountNode* node) { // Inserts a node as the most recently used.
+        node->lruNext = lruHead; // Links the old head behind the node.
+        node->lruPrev = nullptr; // Nothing is in front of the new head.
+        if (lruHead) lruHead->lruPrev = node; // Links the old head back to the node.
+        lruHead = node; // The node becomes the head.
+        if (!lruTail) lruTail = node; // The node is also the tail if the list was empty.
+    }
+
+    void recharge(AccountNode* node) { // Re-estimates the memory charged for a resident account.
+        residentBytes -= node->residentBytes; // Removes the old estimate.
+        node->residentBytes = node->account->estimateMemoryUsage(); // Accounts grow as transactions are added.
+        residentBytes += node->residentBytes; // Adds the new estimate.
+    }
+
+    void evict(AccountNode* node) { // Writes a resident account to disk if it changed and frees its memory.
+        if (node->account->dirty || node->diskOffset < 0) { // An unchanged account already has a current record.
+            if (!writeRecord(node)) { // Appends the new state.
+                disableSpilling("Failed to write account to " + segmentPath);
+                return; // The account stays resident.
+            }
+            if (segmentBytes > SEGMENT_COMPACTION_MIN && segmentBytes > 2 * liveBytes) compact(); // Reclaims space once most of the segment is stale.
+        }
+        unlink(node); // Removes the account from the residency list.
+        residentBytes -= node->residentBytes; // Releases its memory charge.
+        node->residentBytes = 0; // The node no longer holds memory.
+        delete node->account; // Frees the account.
+        node->account = nullptr; // Marks the account as evicted.
+        residentCount--; // One fewer account in memory.
+        evictedCount++; // One more account on disk.
+    }
+
+    void enforceBudget() { // Evicts least recently used accounts until the budget is met.
+        AccountNode* candidate = lruTail; // Starts from the least recently used account.
+        while (spillEnabled && residentBytes > memoryBudget && candidate) { // Loops while over budget and candidates remain.
+            AccountNode* previous = candidate->lruPrev; // Saves the next candidate before evicting.
+            if (candidate->account != pinnedAccount && candidate != lruHead) { // Never evicts the pinned or just-used account.
+                evict(candidate); // Spills the account to disk.
+            }
+            candidate = previous; // Moves to the next least recently used account.
+        }
+    }
+
+public:
+    TieredAccountStore(size_t budget, const string& path) // Constructor sets the memory budget and opens the disk segment.
+        : lruHead(nullptr), lruTail(nullptr), pinnedAccount(nullptr), memoryBudget(budget), residentBytes(0),
+          residentCount(0), evictedCount(0), hits(0), misses(0), basePath(path), segmentPath(path), ownsSegment(false),
+          spillEnabled(true), segmentBytes(0), liveBytes(0) {
+        if (fileExists(segmentPath)) { // The file belongs to someone else.
+            disableSpilling(segmentPath + " already exists and will not be overwritten");
+            return;
+        }
+        segment.open(segmentPath.c_str(), ios::in | ios::out | ios::binary | ios::trunc); // Creates an empty segment.
+        if (!segment) disableSpilling("Cannot open " + segmentPath); // Runs without the disk tier rather than failing later.
+        ownsSegment = segment.is_open(); // Only a file created here is removed on exit.
+    }
+
+    ~TieredAccountStore() { // Destructor closes and removes the disk segment.
+        if (!ownsSegment) return; // Nothing was created.
+        segment.close(); // Closes the segment file.
+        remove(segmentPath.c_str()); // The segment only holds spilled state for this run.
+    }
+
+    void admit(AccountNode* node) { // Registers a newly created resident account.
+        nodes.push_back(node); // Remembers the node for compaction.
+        pushFront(node); // New accounts are the most recently used.
+        residentCount++; // One more account in memory.
+        recharge(node); // Charges its memory to the budget.
+        enforceBudget(); // Evicts idle accounts if the budget is exceeded.
+    }
+
+    Account* access(AccountNode* node) { // Returns a node's account, loading it from disk if needed, or nullptr if it cannot be read.
+        if (node->account) { // The account is resident.
+            hits++; // Counts a memory hit.
+            unlink(node); // Moves the account to the front of the residency list.
+            pushFront(node);
+            recharge(node); // Picks up any growth since the last access.
+        } else { // The account is on disk.
+            misses++; // Counts a miss.
+            Account* acc = new Account(); // Creates an empty account to load into.
+            if (!readRecord(node, *acc)) { // The record could not be read.
+                delete acc; // Frees the partially loaded account.
+                return nullptr; // Reports the account as unavailable.
+            }
+            node->account = acc; // Marks the account as resident.
+            pushFront(node); // A loaded account is the most recently used.
+            residentCount++; // One more account in memory.
+            evictedCount--; // One fewer account on disk.
+            recharge(node); // Charges its memory to the budget.
+        }
+        enforceBudget(); // Evicts idle accounts if the budget is exceeded.
+        return node->account; // Returns the resident account.
+    }
+
+    Account* peek(AccountNode* node, Account& scratch) { // Returns a node's account for a scan without promoting it or counting a lookup.
+        if (node->account) return node->account; // A resident account is used in place.
+        return readRecord(node, scratch) ? &scratch : nullptr; // An evicted account is read into the caller's copy and stays on disk.
+    }
+
+    void pin(Account* acc) { // Keeps an account resident until another account is pinned or nullptr is passed.
+        pinnedAccount = acc; // Records the pinned account.
+    }
+
+    string summary() const { // Returns the residency and hit/miss counters as key=value pairs.
+        return "memory_budget=" + to_string(memoryBudget) + " resident_bytes=" + to_string(residentBytes) // Memory use.
+             + " in_memory=" + to_string(residentCount) + " on_disk=" + to_string(evictedCount) // Account counts.
+             + " hits=" + to_string(hits) + " misses=" + to_string(misses) // Lookup counters.
+             + " segment_bytes=" + to_string(static_cast<long long>(segmentBytes)) + " live_bytes=" + to_string(static_cast<long long>(liveBytes)) // Segment size.
+             + " spilling=" + (spillEnabled ? "on" : "off"); // Whether the disk tier is in use.
+    }
+
+    void displayStatistics() const { // Displays residency and hit/miss counters.
+        long long lookups = hits + misses; // Total number of lookups.
+        cout << "\n--- Account Storage Statistics ---\n"; // Header for statistics display.
+        cout << "Memory budget: " << memoryBudget << " bytes\n"; // Displays the configured budget.
+        cout << "Resident memory: " << residentBytes << " bytes\n"; // Displays the estimated resident memory.
+        cout << "Accounts in memory: " << residentCount << "\n"; // Displays the number of hot accounts.
+        cout << "Accounts on disk: " << evictedCount << "\n"; // Displays the number of cold accounts.
+        cout << "Disk segment: " << (spillEnabled ? segmentPath : "disabled") << ", " << segmentBytes << " bytes, " << liveBytes << " live\n"; // Displays the segment size.
+        cout << "Hits: " << hits << ", Misses: " << misses; // Displays the lookup counters.
+        if (lookups > 0) { // Avoids dividing by zero before any lookup.
+            cout << ", Hit rate: " << fixed << setprecision(1) << (100.0 * hits / lookups) << "%"; // Displays the hit rate.
+            cout.unsetf(ios::fixed); // Restores the default number format.
+            cout << setprecision(6);
+        }
+        cout << "\n";
+    }
+};
+
+// Trie node for the customer name index
+class NameTrieNode {
+public:
+    char key; // Lowercased character on the edge leading to this node.
+    vector<NameTrieNode*> children; // Child nodes sorted by key.
+    vector<AccountNode*> accounts; // Accounts whose lowercased name ends at this node.
+
+    NameTrieNode(char k) : key(k) {} // Constructor initializes a node with no children.
+
+    ~NameTrieNode() { // Destructor frees the whole subtree.
+        for (size_t i = 0; i < children.size(); ++i) { // Loops through the children.
+            delete children[i]; // Frees each child subtree.
+        }
+    }
+
+    NameTrieNode* findChild(char c) const { // Finds the child for a character using binary search.
+        size_t low = 0, high = children.size(); // Search range over the sorted children.
+        while (low < high) { // Loops until the range is empty.
+            size_t mid = (low + high) / 2; // Middle of the range.
+            if (children[mid]->key < c) low = mid + 1; // Continues in the upper half.
+            else high = mid; // Continues in the lower half.
+        }
+        return (low < children.size() && children[low]->key == c) ? children[low] : nullptr; // Returns the child if it exists.
+    }
+
+    NameTrieNode* addChild(char c) { // Returns the child for a character, creating it if needed.
+        size_t position = 0; // Insert position that keeps the children sorted.
+        while (position < children.size() && children[position]->key < c) position++; // Finds the first larger key.
+        if (position < children.size() && children[position]->key == c) return children[position]; // The child already exists.
+        NameTrieNode* child = new NameTrieNode(c); // Creates the new child.
+        children.insert(children.begin() + position, child); // Inserts it in sorted order.
+        return child; // Returns the new child.
+    }
+};
+
+// Result of a customer name search
+struct NameMatch {
+    AccountNode* node; // Matching account node.
+    int distance; // Edit distance between the query and the name or one of its prefixes.
+};
+
+// Trie-based index over customer names supporting exact, prefix and typo-tolerant lookups
+class NameTrie {
+private:
+    NameTrieNode root; // Root node, which holds no character.
+
+    static string normalize(const string& name) { // Lowercases a name so searches ignore case.
+        string result = name; // Copy of the name.
+        for (size_t i = 0; i < result.size(); ++i) { // Loops through every character.
+            result[i] = static_cast<char>(tolower(static_cast<unsigned char>(result[i]))); // Lowercases the character.
+        }
+        return result; // Returns the normalized name.
+    }
+
+    static bool ranksBefore(const NameMatch& a, const NameMatch& b) { // Orders matches by distance, then name length, then name.
+        if (a.distance != b.distance) return a.distance < b.distance; // Closer matches first.
+        if (a.node->customerName.size() != b.node->customerName.size()) // Shorter names are closer to a prefix query.
+            return a.node->customerName.size() < b.node->customerName.size();
+        return a.node->customerName < b.node->customerName; // Alphabetical order breaks the remaining ties.
+    }
+
+    static void offer(vector<NameMatch>& results, size_t maxResults, AccountNode* node, int distance) { // Adds a match if it ranks in the top results.
+        NameMatch match = { node, distance }; // The candidate match.
+        if (results.size() >= maxResults && !ranksBefore(match, results.back())) return; // Not better than the worst kept match.
+        size_t position = results.size(); // Insert position that keeps the results ranked.
+        while (position > 0 && ranksBefore(match, results[position - 1])) position--; // Moves the match up past worse ones.
+        results.insert(results.begin() + position, match); // Inserts the match.
+        if (results.size() > maxResults) results.pop_back(); // Drops the worst match if over the limit.
+    }
+
+    static void collectSubtree(NameTrieNode* node, int distance, vector<NameMatch>& results, size_t maxResults) { // Adds every name below a node, shortest first.
+        CustomQueue<NameTrieNode*> q; // Queue for a breadth-first walk so shorter names come first.
+        for (size_t i = 0; i < node->children.size(); ++i) q.enqueue(node->children[i]); // Starts with the node's children.
+        size_t collected = 0; // Names added from this subtree.
+        while (!q.empty() && collected < maxResults) { // Later names rank no better, so stop after maxResults.
+            NameTrieNode* current = q.front(); // Gets the front node from the queue.
+            q.dequeue(); // Dequeues the front node.
+            for (size_t i = 0; i < current->accounts.size() && collected < maxResults; ++i, ++collected) { // Adds the names ending here.
+                offer(results, maxResults, current->accounts[i], distance);
+            }
+            for (size_t i = 0; i < current->children.size(); ++i) q.enqueue(current->children[i]); // Enqueues the children.
+        }
+    }
+
+    static void searchNode(NameTrieNode* node, const string& query, const vector<int>& previousRow, int bestPrefix, // Walks the trie computing one Levenshtein row per node.
+                           int maxDistance, vector<NameMatch>& results, size_t maxResults) {
+        size_t columns = query.size() + 1; // One column per query prefix length.
+        vector<int> row(columns); // Edit distances from the path to this node to each query prefix.
+        row[0] = previousRow[0] + 1; // Matching an empty query prefix costs one deletion per character.
+        int minRow = row[0]; // Smallest distance in the row.
+        for (size_t i = 1; i < columns; ++i) { // Fills the rest of the row.
+            int insertCost = row[i - 1] + 1; // Inserting a query character.
+            int deleteCost = previousRow[i] + 1; // Deleting a name character.
+            int replaceCost = previousRow[i - 1] + (query[i - 1] == node->key ? 0 : 1); // Matching or replacing a character.
+            row[i] = min(insertCost, min(deleteCost, replaceCost)); // Keeps the cheapest edit.
+            minRow = min(minRow, row[i]); // Tracks the smallest distance.
+        }
+        bestPrefix = min(bestPrefix, row[columns - 1]); // Best distance of the whole query to any prefix on this path.
+
+        if (bestPrefix <= maxDistance) { // The names ending here match.
+            for (size_t i = 0; i < node->accounts.size(); ++i) offer(results, maxResults, node->accounts[i], bestPrefix);
+        }
+        if (minRow > maxDistance) { // No longer path can bring the full query within range.
+            if (bestPrefix <= maxDistance) collectSubtree(node, bestPrefix, results, maxResults); // Every longer name still matches by prefix.
+            return; // Stops descending.
+        }
+        if (results.size() >= maxResults && min(bestPrefix, minRow) > results.back().distance) return; // Nothing below can rank higher.
+        for (size_t i = 0; i < node->children.size(); ++i) { // Descends into every child.
+            searchNode(node->children[i], query, row, bestPrefix, maxDistance, results, maxResults);
+        }
+    }
+
+public:
+    NameTrie() : root('\0') {} // Initializes an empty index.
+
+    void insert(AccountNode* node) { // Adds an account to the index under its customer name.
+        string key = normalize(node->customerName); // Names are indexed case-insensitively.
+        NameTrieNode* current = &root; // Starts at the root.
+        for (size_t i = 0; i < key.size(); ++i) { // Walks or creates the path for the name.
+            current = current->addChild(key[i]);
+        }
+        current->accounts.push_back(node); // Records the account at the end of the path.
+    }
+
+    AccountNode* findExact(const string& name) const { // Finds the account whose name matches exactly, including case.
+        string key = normalize(name); // Path of the name in the trie.
+        const NameTrieNode* current = &root; // Starts at the root.
+        for (size_t i = 0; i < key.size() && current; ++i) { // Follows the path.
+            current = current->findChild(key[i]);
+        }
+        if (!current) return nullptr; // The name is not in the index.
+        for (size_t i = 0; i < current->accounts.size(); ++i) { // Names that differ only in case share a node.
+            if (current->accounts[i]->customerName == name) return current->accounts[i]; // Returns the exact match.
+        }
+        return nullptr; // Only names with different case were found.
+    }
+
+    vector<NameMatch> search(const string& query, size_t maxResults) { // Returns the best prefix and typo-tolerant matches, ranked.
+        vector<NameMatch> results; // Ranked matches.
+        string key = normalize(query); // Queries ignore case.
+        if (key.empty() || maxResults == 0) return results; // Nothing to search for.
+        int maxDistance = key.size() <= 3 ? 0 : (key.size() <= 6 ? 1 : 2); // Short queries allow fewer typos.
+        vector<int> firstRow(key.size() + 1); // Distances from the empty path to each query prefix.
+        for (size_t i = 0; i < firstRow.size(); ++i) firstRow[i] = static_cast<int>(i); // Each query character must be inserted.
+        for (size_t i = 0; i < root.children.size(); ++i) { // Searches below each first character.
+            searchNode(root.children[i], key, firstRow, static_cast<int>(key.size()), maxDistance, results, maxResults);
+        }
+        return results; // Returns the ranked matches.
+    }
 };
 
 // Binary search tree for managing accounts
 class AccountBinaryTree {
 private:
     AccountNode* root; // Pointer to the root of the binary tree.
+    TieredAccountStore store; // Keeps hot accounts in memory and spills cold ones to disk.
+    NameTrie nameIndex; // Index of customer names for exact and fuzzy lookups.
 
-    void insert(AccountNode*& node, Account* acc) { // Inserts a new account into the binary tree.
+    void insert(AccountNode*& node, AccountNode* newNode) { // Inserts a new account node into the binary tree.
         if (node == nullptr) { // If the current node is null.
-            node = new AccountNode(acc); // Creates a new account node.
-        } else if (acc->accountNumber < node->account->accountNumber) { // If the account number is less than the current node's account number.
-            insert(node->left, acc); // Recursively inserts into the left subtree.
+            node = newNode; // Places the new account node here.
+        } else if (newNode->accountNumber < node->accountNumber) { // If the account number is less than the current node's account number.
+            insert(node->left, newNode); // Recursively inserts into the left subtree.
         } else {
-            insert(node->right, acc); // Recursively inserts into the right subtree.
+            insert(node->right, newNode); // Recursively inserts into the right subtree.
         }
     }
 
-    Account* search(AccountNode* node, int accountNumber) { // Searches for an account by account number.
+    AccountNode* search(AccountNode* node, int accountNumber) { // Searches for an account node by account number.
         if (node == nullptr) { // If the current node is null.
             return nullptr; // Returns null if the account is not found.
-        } else if (node->account->accountNumber == accountNumber) { // If the account number matches.
-            return node->account; // Returns the found account.
-        } else if (accountNumber < node->account->accountNumber) { // If the account number is less than the current node's account number.
+        } else if (node->accountNumber == accountNumber) { // If the account number matches.
+            return node; // Returns the found node.
+        } else if (accountNumber < node->accountNumber) { // If the account number is less than the current node's account number.
             return search(node->left, accountNumber); // Recursively searches in the left subtree.
         } else {
             return search(node->right, accountNumber); // Recursively searches in the right subtree.
@@ -275,23 +840,66 @@ private:
     void inOrderDisplay(AccountNode* node) { // Displays accounts in in-order traversal.
         if (node == nullptr) return; // Base case: if the node is null, return.
         inOrderDisplay(node->left); // Recursively display the left subtree.
-        cout << "| Account Number: " << node->account->accountNumber // Displays account number.
-             << " | Customer Name: " << node->account->customerName // Displays customer name.
-             << " | Balance: " << node->account->balance << " |\n"; // Displays account balance.
+        Account scratch; // Holds the account if it has to be read from disk.
+        Account* acc = store.peek(node, scratch); // Reads the account without changing its residency.
+        if (acc) cout << "| Account Number: " << acc->accountNumber // Displays account number.
+             << " | Customer Name: " << acc->customerName // Displays customer name.
+             << " | Balance: " << acc->balance << " |\n"; // Displays account balance.
         inOrderDisplay(node->right); // Recursively display the right subtree.
     }
 
 public:
-    AccountBinaryTree() : root(nullptr) {} // Initializes an empty binary tree.
+    AccountBinaryTree(size_t memoryBudget, const string& segmentPath) // Initializes an empty binary tree with its backing store.
+        : root(nullptr), store(memoryBudget, segmentPath) {}
 
     void addAccount(Account* acc) { // Adds a new account to the binary tree.
-        insert(root, acc); // Calls the insert function starting from the root.
+        AccountNode* node = new AccountNode(acc); // Creates a new account node.
+        insert(root, node); // Calls the insert function starting from the root.
+        nameIndex.insert(node); // Indexes the customer name.
+        store.admit(node); // Makes the new account resident.
+    }
+
+    Account* findAccountByName(const string& name) { // Finds an account by its exact customer name.
+        AccountNode* node = nameIndex.findExact(name); // Looks the name up in the index.
+        return node ? store.access(node) : nullptr; // Loads the account if it is on disk.
+    }
+
+    vector<NameMatch> searchByName(const string& query, size_t maxResults) { // Finds accounts by name prefix or close spelling.
+        return nameIndex.search(query, maxResults); // Delegates to the name index.
     }
 
     Account* findAccount(int accountNumber) { // Finds an account by account number.
+        AccountNode* node = search(root, accountNumber); // Calls the search function starting from the root.
+        return node ? store.access(node) : nullptr; // Loads the account if it is on disk.
+    }
+
+    AccountNode* findNode(int accountNumber) { // Finds the node of an account without loading the account.
         return search(root, accountNumber); // Calls the search function starting from the root.
     }
 
+    Account* scanAccount(AccountNode* node, Account& scratch) { // Returns the account of a node found by traversal, without promoting it.
+        return store.peek(node, scratch); // Delegates to the tiered store.
+    }
+
+    void pinAccount(Account* acc) { // Keeps an account resident while it is in use.
+        store.pin(acc); // Delegates to the tiered store.
+    }
+
+    void displayStorageStatistics() const { // Displays residency and hit/miss counters.
+        store.displayStatistics(); // Delegates to the tiered store.
+    }
+
+    string storageSummary() const { // Returns residency and hit/miss counters on one line.
+        return store.summary(); // Delegates to the tiered store.
+    }
+
+    void collectInOrder(AccountNode* node, vector<AccountNode*>& nodes) { // Appends the nodes of a subtree sorted by account number.
+        if (node == nullptr) return; // Base case: if the node is null, return.
+        collectInOrder(node->left, nodes); // Collects the left subtree.
+        nodes.push_back(node); // Adds this node.
+        collectInOrder(node->right, nodes); // Collects the right subtree.
+    }
+
     AccountNode* getRoot() { // Returns the root of the binary tree.
         return root; // Returns the root node.
     }
@@ -309,18 +917,370 @@ public:
     }
 };
 
+// Transaction held for admin review
+struct FlaggedTransaction {
+    int accountNumber; // Account that made the transaction.
+    string customerName; // Name of the account holder.
+    string type; // Transaction type, such as Deposit or Withdraw.
+    double amount; // Transaction amount.
+    int flags; // FraudDetector flags that were raised.
+    time_t flaggedAt; // Wall-clock time the transaction was flagged.
+};
+
+// Streaming anomaly detector applied to each transaction
+class FraudDetector {
+private:
+    long long velocityWindowMillis; // Length of the sliding window for the velocity check.
+    int maxInWindow; // Transactions allowed inside the window before flagging.
+    double zScoreThreshold; // Amount z-score above which a transaction is flagged.
+    int minSamples; // Transactions needed before amount and burst checks start.
+    double burstRatio; // A gap this many times shorter than the average gap is a burst.
+
+public:
+    enum Flag { // Reasons a transaction can be flagged.
+        FLAG_VELOCITY = 1, // Too many transactions in the sliding window.
+        FLAG_AMOUNT = 2, // Amount far from this account's usual amounts.
+        FLAG_BURST = 4 // Transaction arrived much sooner than usual.
+    };
+
+    FraudDetector(long long windowMillis = 60000, int maxTransactions = 5, double zThreshold = 3.0, int samples = 5, double ratio = 10.0) // Constructor sets the detection thresholds.
+        : velocityWindowMillis(windowMillis), maxInWindow(min(maxTransactions, TransactionMonitorState::VELOCITY_SLOTS)),
+          zScoreThreshold(zThreshold), minSamples(samples), burstRatio(ratio) {}
+
+    int inspect(TransactionMonitorState& state, double amount) const { // Checks a transaction and folds it into the account statistics.
+        long long now = BankClock::nowMillis(); // Time of this transaction.
+        int flags = 0; // Flags raised for this transaction.
+
+        if (state.recentCount >= maxInWindow) { // Enough history to fill the window.
+            int slot = (state.nextSlot - maxInWindow + TransactionMonitorState::VELOCITY_SLOTS) % TransactionMonitorState::VELOCITY_SLOTS; // Oldest of the last maxInWindow transactions.
+            if (now - state.recentTimes[slot] < velocityWindowMillis) flags |= FLAG_VELOCITY; // This one exceeds the allowed count.
+        }
+
+        if (state.transactionCount >= minSamples) { // Enough history for amount and burst checks.
+            double deviation = sqrt(state.amountM2 / (state.transactionCount - 1)); // Sample standard deviation of past amounts.
+            deviation = max(deviation, state.amountMean * 0.05); // Floor stops identical past amounts from flagging every change.
+            if (deviation > 0 && fabs(amount - state.amountMean) / deviation > zScoreThreshold) flags |= FLAG_AMOUNT; // Unusual amount.
+            long long gap = now - state.lastTime; // Time since the previous transaction.
+            if (gap * burstRatio < state.meanGap) flags |= FLAG_BURST; // Much sooner than usual.
+        }
+
+        state.recentTimes[state.nextSlot] = now; // Records this transaction in the ring buffer.
+        state.nextSlot = (state.nextSlot + 1) % TransactionMonitorState::VELOCITY_SLOTS; // Advances the ring buffer.
+        if (state.recentCount < TransactionMonitorState::VELOCITY_SLOTS) state.recentCount++; // Counts valid entries.
+        if (state.transactionCount > 0) { // A gap exists only after the first transaction.
+            double gap = static_cast<double>(now - state.lastTime); // Time since the previous transaction.
+            state.meanGap = state.transactionCount == 1 ? gap : 0.8 * state.meanGap + 0.2 * gap; // Updates the average gap.
+        }
+        state.lastTime = now; // Remembers this transaction's time.
+        state.transactionCount++; // Counts this transaction.
+        double delta = amount - state.amountMean; // Welford's online update of mean and variance.
+        state.amountMean += delta / state.transactionCount;
+        state.amountM2 += delta * (amount - state.amountMean);
+        return flags; // Returns the raised flags.
+    }
+
+    static string describeFlags(int flags) { // Returns a readable list of raised flags.
+        string description; // Accumulated description.
+        if (flags & FLAG_VELOCITY) description += "high velocity, "; // Velocity flag.
+        if (flags & FLAG_AMOUNT) description += "unusual amount, "; // Amount flag.
+        if (flags & FLAG_BURST) description += "burst, "; // Burst flag.
+        return description.empty() ? "none" : description.substr(0, description.size() - 2); // Drops the trailing separator.
+    }
+};
+
+const double AUDIT_MAX_CENT_AMOUNT = 1e15; // Amounts from here up are stored as raw doubles, far below where cents * 2 would overflow.
+
+// Variable-length integer encoding shared by the audit log writer and reader
+class AuditEncoding {
+public:
+    static void putVarint(string& out, unsigned long long value) { // Appends 7 bits per byte, high bit set on all but the last.
+        while (value >= 0x80) { // Loops while more than 7 bits remain.
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80)); // Writes the low 7 bits with the continuation bit.
+            value >>= 7; // Moves to the next 7 bits.
+        }
+        out.push_back(static_cast<char>(value)); // Writes the last byte.
+    }
+
+    static void putSigned(string& out, long long value) { // Appends a signed value using zigzag encoding so small negatives stay short.
+        putVarint(out, (static_cast<unsigned long long>(value) << 1) ^ static_cast<unsigned long long>(value >> 63));
+    }
+
+    static void putString(string& out, const string& value) { // Appends a length-prefixed string.
+        putVarint(out, value.size()); // Writes the length.
+        out += value; // Writes the characters.
+    }
+
+    static unsigned long long getVarint(istream& in) { // Reads a value written by putVarint.
+        unsigned long long value = 0; // Decoded value.
+        for (int shift = 0; shift < 64; shift += 7) { // Reads at most ten bytes.
+            int byte = in.get(); // Reads the next byte.
+            if (byte == EOF) throw runtime_error("Audit log is truncated"); // Reports a short file.
+            value |= static_cast<unsigned long long>(byte & 0x7F) << shift; // Adds the 7 data bits.
+            if (!(byte & 0x80)) return value; // The continuation bit is clear on the last byte.
+        }
+        throw runtime_error("Audit log contains an invalid number"); // Reports an overlong encoding.
+    }
+
+    static long long getSigned(istream& in) { // Reads a value written by putSigned.
+        unsigned long long raw = getVarint(in); // Reads the zigzag value.
+        return static_cast<long long>(raw >> 1) ^ -static_cast<long long>(raw & 1); // Undoes the zigzag encoding.
+    }
+
+    static void putAmount(string& out, double amount) { // Appends an amount, in cents when that is exact and as raw bits otherwise.
+        if (fabs(amount) < AUDIT_MAX_CENT_AMOUNT) { // Larger amounts would overflow the tagged cent value.
+            long long cents = llround(amount * 100); // Amount in whole cents.
+            if (cents / 100.0 == amount) { // Whole-cent amounts are the common case and encode in a few bytes.
+                putSigned(out, cents * 2); // An even tag marks a cent value.
+                return;
+            }
+        }
+        putSigned(out, 1); // An odd tag marks an exact double that follows.
+        out.append(reinterpret_cast<const char*>(&amount), sizeof(amount)); // Keeps every bit so replay matches the live balance.
+    }
+
+    static double getAmount(istream& in) { // Reads an amount written by putAmount.
+        long long tagged = getSigned(in); // Cents times two, or 1 for a raw double.
+        if (tagged % 2 == 0) return (tagged / 2) / 100.0; // Converts cents back to the same double.
+        double amount; // Raw double.
+        if (!in.read(reinterpret_cast<char*>(&amount), sizeof(amount))) throw runtime_error("Audit log is truncated"); // Reads its bits.
+        return amount; // Returns the exact amount.
+    }
+
+    static string getString(istream& in) { // Reads a string written by putString.
+        unsigned long long length = getVarint(in); // Reads the length.
+        string value; // Decoded string.
+        for (unsigned long long i = 0; i < length; ++i) { // Reads the characters one by one so a bad length fails cleanly.
+            int c = in.get(); // Reads the next character.
+            if (c == EOF) throw runtime_error("Audit log is truncated"); // Reports a short file.
+            value.push_back(static_cast<char>(c)); // Appends the character.
+        }
+        return value; // Returns the string.
+    }
+};
+
+const char AUDIT_LOG_MAGIC[] = "BMSAUD02"; // File signature and format version of audit logs.
+
+// Writes every account's transactions to a compact column-oriented audit log
+class AuditLogWriter {
+private:
+    string accountNumbers; // Column of delta-encoded account numbers.
+    string customerNames; // Column of customer names.
+    string rowCounts; // Column of transaction counts per account.
+    string timestamps; // Column of delta-encoded transaction timestamps.
+    string types; // Column of dictionary indexes, one byte per transaction.
+    string amounts; // Column of amounts, in cents where exact.
+    int previousAccountNumber; // Last account number written, for delta encoding.
+    long long previousTimestamp; // Last timestamp written, for delta encoding.
+    size_t accountCount; // Number of accounts added.
+    size_t transactionCount; // Number of transactions added.
+
+public:
+    AuditLogWriter() : previousAccountNumber(0), previousTimestamp(0), accountCount(0), transactionCount(0) {} // Initializes empty columns.
+
+    void addAccount(const Account& acc) { // Appends an account and all of its transactions to the columns.
+        AuditEncoding::putSigned(accountNumbers, static_cast<long long>(acc.accountNumber) - previousAccountNumber); // Stores the difference from the previous account.
+        previousAccountNumber = acc.accountNumber;
+        AuditEncoding::putString(customerNames, acc.customerName); // Stores the customer name.
+        AuditEncoding::putVarint(rowCounts, acc.auditTrail.size()); // Stores how many transactions follow.
+        for (size_t i = 0; i < acc.auditTrail.size(); ++i) { // Loops through the account's transactions.
+            const TransactionRecord& record = acc.auditTrail[i]; // Current transaction.
+            AuditEncoding::putSigned(timestamps, record.timestamp - previousTimestamp); // Timestamps close together encode in a byte or two.
+            previousTimestamp = record.timestamp;
+            types.push_back(static_cast<char>(record.type)); // Index into the type dictionary.
+            AuditEncoding::putAmount(amounts, record.amount); // Stores the exact amount, compactly when it is whole cents.
+        }
+        accountCount++; // Counts the account.
+        transactionCount += acc.auditTrail.size(); // Counts its transactions.
+    }
+
+    size_t getAccountCount() const { return accountCount; } // Returns the number of accounts added.
+    size_t getTransactionCount() const { return transactionCount; } // Returns the number of transactions added.
+
+    bool writeFile(const string& path) const { // Writes the header, type dictionary and all columns to a file.
+        string header(AUDIT_LOG_MAGIC, sizeof(AUDIT_LOG_MAGIC) - 1); // File signature.
+        AuditEncoding::putVarint(header, TXN_TYPE_COUNT); // Number of dictionary entries.
+        for (int i = 0; i < TXN_TYPE_COUNT; ++i) { // Writes the type dictionary.
+            AuditEncoding::putString(header, TRANSACTION_TYPE_NAMES[i]);
+        }
+        AuditEncoding::putVarint(header, accountCount); // Number of accounts.
+        AuditEncoding::putVarint(header, transactionCount); // Number of transactions.
+        ofstream out(path.c_str(), ios::binary | ios::trunc); // Opens the output file.
+        out << header << accountNumbers << customerNames << rowCounts << timestamps << types << amounts; // Writes the columns one after another.
+        return static_cast<bool>(out); // Reports whether every write succeeded.
+    }
+};
+
+// Account state rebuilt from an audit log
+struct ReplayedAccount {
+    int accountNumber; // Account number from the log.
+    string customerName; // Customer name from the log.
+    double balance; // Balance after replaying every transaction.
+    double loanAmount; // Outstanding loan after replaying every transaction.
+    size_t transactionCount; // Number of transactions replayed.
+};
+
+// Reads an audit log and rebuilds account state by replaying its transactions in order
+class AuditLogReplayer {
+public:
+    static vector<ReplayedAccount> replay(const string& path) { // Returns the replayed accounts, throwing runtime_error on a bad file.
+        ifstream in(path.c_str(), ios::binary); // Opens the audit log; columns are read in sequence straight from the file.
+        if (!in) throw runtime_error("Unable to open " + path); // Reports a missing file.
+        in.seekg(0, ios::end); // Finds the file size so header counts can be checked before allocating.
+        unsigned long long fileSize = static_cast<unsigned long long>(in.tellg());
+        in.seekg(0, ios::beg); // Returns to the signature.
+        char magic[sizeof(AUDIT_LOG_MAGIC) - 1]; // Buffer for the file signature.
+        if (!in.read(magic, sizeof(magic)) || string(magic, sizeof(magic)) != string(AUDIT_LOG_MAGIC, sizeof(magic))) { // Checks the signature.
+            throw runtime_error(path + " is not an audit log"); // Reports an unrecognized file.
+        }
+
+        unsigned long long dictionarySize = AuditEncoding::getVarint(in); // Number of type names.
+        vector<int> typeMap; // Maps file dictionary indexes to this program's transaction types.
+        for (unsigned long long i = 0; i < dictionarySize; ++i) { // Reads the type dictionary.
+            string name = AuditEncoding::getString(in); // Type name stored in the file.
+            int type = -1; // Unknown until matched.
+            for (int t = 0; t < TXN_TYPE_COUNT; ++t) { // Looks the name up by text so type order can change.
+                if (name == TRANSACTION_TYPE_NAMES[t]) type = t;
+            }
+            typeMap.push_back(type); // Records the mapping.
+        }
+
+        unsigned long long accountCount = AuditEncoding::getVarint(in); // Number of accounts in the log.
+        unsigned long long transactionCount = AuditEncoding::getVarint(in); // Number of transactions in the log.
+        unsigned long long remaining = fileSize - static_cast<unsigned long long>(in.tellg()); // Bytes left for the columns.
+        if (accountCount > remaining / 3 || transactionCount > remaining / 3 || accountCount * 3 + transactionCount * 3 > remaining) { // Each account and each transaction takes at least three bytes.
+            throw runtime_error("Audit log header does not match the file size"); // Refuses to allocate for counts the file cannot hold.
+        }
+        vector<ReplayedAccount> accounts(accountCount); // Rebuilt accounts.
+        long long accountNumber = 0; // Running value for delta decoding.
+        for (size_t i = 0; i < accounts.size(); ++i) { // Reads the account number column.
+            accountNumber += AuditEncoding::getSigned(in);
+            accounts[i].accountNumber = static_cast<int>(accountNumber);
+            accounts[i].balance = 0; // Every account starts empty until its opening record.
+            accounts[i].loanAmount = 0; // No loan until one is recorded.
+        }
+        for (size_t i = 0; i < accounts.size(); ++i) accounts[i].customerName = AuditEncoding::getString(in); // Reads the name column.
+        unsigned long long rowTotal = 0; // Sum of per-account transaction counts.
+        for (size_t i = 0; i < accounts.size(); ++i) { // Reads the transaction count column.
+            accounts[i].transactionCount = AuditEncoding::getVarint(in);
+            rowTotal += accounts[i].transactionCount;
+        }
+        if (rowTotal != transactionCount) throw runtime_error("Audit log transaction counts do not match"); // Checks the header against the columns.
+
+        vector<long long> times(transactionCount); // Decoded timestamp column.
+        long long timestamp = 0; // Running value for delta decoding.
+        for (size_t i = 0; i < times.size(); ++i) { // Reads the timestamp column.
+            timestamp += AuditEncoding::getSigned(in);
+            times[i] = timestamp;
+        }
+        string typeColumn(transactionCount, '\0'); // Type column, one byte per transaction.
+        if (transactionCount > 0 && !in.read(&typeColumn[0], transactionCount)) throw runtime_error("Audit log is truncated"); // Reads the type column.
+
+        size_t row = 0; // Current transaction across all accounts.
+        for (size_t i = 0; i < accounts.size(); ++i) { // Replays each account's transactions in order.
+            long long previousTime = 0; // Timestamp of the previous transaction of this account.
+            for (size_t j = 0; j < accounts[i].transactionCount; ++j, ++row) {
+                double amount = AuditEncoding::getAmount(in); // Reads the amount column.
+                unsigned char index = static_cast<unsigned char>(typeColumn[row]); // Dictionary index of the type.
+                int type = index < typeMap.size() ? typeMap[index] : -1; // Transaction type.
+                if (times[row] < previousTime) throw runtime_error("Audit log timestamps go backwards for account " + to_string(accounts[i].accountNumber)); // Replay requires ordered transactions.
+                previousTime = times[row];
+                switch (type) { // Applies the transaction to the rebuilt state.
+                    case TXN_ACCOUNT_OPENED: accounts[i].balance = amount; break; // Sets the opening balance.
+                    case TXN_DEPOSIT: accounts[i].balance += amount; break; // Adds a deposit.
+                    case TXN_WITHDRAW: accounts[i].balance -= amount; break; // Subtracts a withdrawal.
+                    case TXN_LOAN_REQUESTED: accounts[i].loanAmount = amount; break; // Records the loan.
+                    case TXN_LOAN_CLEARED: accounts[i].loanAmount = 0; break; // Clears the loan.
+                    default: throw runtime_error("Audit log contains an unknown transaction type"); // Refuses to guess.
+                }
+            }
+        }
+        return accounts; // Returns the rebuilt accounts.
+    }
+};
+
+const size_t DEFAULT_MEMORY_BUDGET = 4 * 1024 * 1024; // Default bytes of account data kept in memory.
+
+string uniqueSegmentPath() { // Returns a segment file name in the working directory not used by another running instance.
+    long long stamp = chrono::duration_cast<chrono::microseconds>(chrono::system_clock::now().time_since_epoch()).count(); // Start time of this process.
+    for (int attempt = 0; ; ++attempt) { // Tries names until one does not exist.
+        string path = "accounts_cold_" + to_string(stamp) + "_" + to_string(attempt) + ".seg"; // Candidate name.
+        ifstream existing(path.c_str()); // Checks whether the file exists.
+        if (!existing) return path; // Uses the first free name.
+    }
+}
+const size_t NAME_SEARCH_LIMIT = 10; // Maximum number of results shown by the admin name search.
+const size_t PROTOCOL_BATCH_LIMIT = 1024; // Maximum pipelined commands executed before responses are written.
+const unsigned long PROTOCOL_MAX_FRAME = 1 << 20; // Largest binary frame accepted, in bytes.
+const char* const LOAN_REASONS[] = { // Predefined loan reasons, numbered from 1 in menus and commands.
+    "Medical Emergency", "Education", "Home Renovation", "Business Investment", "Car Purchase"
+};
+const int LOAN_REASON_COUNT = sizeof(LOAN_REASONS) / sizeof(LOAN_REASONS[0]); // Number of loan reasons.
+
 // Bank Management System
 class BankManagementSystem {
 private:
     AccountBinaryTree accountTree; // Binary tree to manage accounts.
     Account* currentUser  = nullptr; // Pointer to the currently logged-in user.
     string adminPassword = "admin123"; // Hardcoded admin password for access control.
+    FraudDetector fraudDetector; // Streaming anomaly detector for deposits and withdrawals.
+    CustomQueue<FlaggedTransaction> reviewQueue; // Flagged transactions waiting for admin review.
+    int pendingReviews = 0; // Number of transactions in the review queue.
+    bool adminSession = false; // Whether the command protocol session has authenticated as admin.
+    bool protocolBroken = false; // Whether the binary protocol lost frame alignment.
+
+    void screenTransaction(Account* acc, const string& type, double amount) { // Runs the fraud detector and queues flagged transactions.
+        int flags = fraudDetector.inspect(acc->monitorState, amount); // Checks the transaction.
+        if (flags) { // Something looked unusual.
+            FlaggedTransaction flagged = { acc->accountNumber, acc->customerName, type, amount, flags, time(0) }; // Builds the review entry.
+            reviewQueue.enqueue(flagged); // Queues it for the admin.
+            pendingReviews++; // Counts the pending review.
+        }
+    }
+
+    Account* openAccount(const string& name, double initialBalance, const string& password) { // Creates an account and adds it to the system.
+        int accountNumber = rand() % 9000 + 1000; // Generates a random account number between 1000 and 9999.
+        Account* newAccount = new Account(accountNumber, name, initialBalance, password); // Creates a new account object with the provided details.
+        accountTree.addAccount(newAccount); // Adds the new account to the binary tree.
+        return newAccount; // Returns the new account.
+    }
+
+    void applyDeposit(Account* acc, double amount) { // Adds a validated deposit to an account.
+        screenTransaction(acc, "Deposit", amount); // Checks the deposit for unusual activity.
+        acc->balance += amount; // Updates the balance with the deposit amount.
+        acc->addTransaction(TXN_DEPOSIT, amount, "Deposit: " + to_string(amount)); // Adds a transaction record for the deposit.
+    }
+
+    bool applyWithdrawal(Account* acc, double amount) { // Takes a validated withdrawal from an account, returning false on insufficient funds.
+        if (acc->balance < amount) return false; // Checks if the balance is sufficient for the withdrawal.
+        screenTransaction(acc, "Withdraw", amount); // Checks the withdrawal for unusual activity.
+        acc->balance -= amount; // Deducts the withdrawal amount from the balance.
+        acc->addTransaction(TXN_WITHDRAW, amount, "Withdraw: " + to_string(amount)); // Adds a transaction record for the withdrawal.
+        return true; // The withdrawal was applied.
+    }
+
+    bool loanWithinLimit(const Account* acc, double loanAmount) const { // Applies the loan approval rules for the account's balance range.
+        return (acc->balance < 50000 && loanAmount <= 100000) // Balance below 50,000 allows loans up to 100,000.
+            || (acc->balance >= 50000 && acc->balance <= 100000 && loanAmount <= 8000); // Balance of 50,000 to 100,000 allows loans up to 8,000.
+    }
+
+    void logIn(Account* acc) { // Makes an account the current user.
+        currentUser  = acc; // Sets the current user to the logged-in account.
+        accountTree.pinAccount(currentUser ); // Keeps the logged-in account in memory.
+    }
+
+    void logOut() { // Clears the current user.
+        currentUser  = nullptr; // Logs out the current user by setting currentUser  to nullptr.
+        accountTree.pinAccount(nullptr); // Lets the account be evicted again.
+    }
 
     Account* findAccountByNumber(int accountNumber) { // Finds an account by account number.
         return accountTree.findAccount(accountNumber); // Calls the findAccount method of the binary tree.
     }
 
 public:
+    BankManagementSystem(size_t memoryBudget, const string& segmentPath) // Constructor sets how much account data stays in memory and where the rest goes.
+        : accountTree(memoryBudget, segmentPath) {}
+
     void signup() { // Handles user signup process.
         string name; // Variable to store customer name.
         string password; // Variable to store password.
@@ -351,10 +1311,8 @@ public:
             }
         } while (password.length() < 5 || password.length() > 8); // Repeats until a valid password is entered.
 
-        int accountNumber = rand() % 9000 + 1000; // Generates a random account number between 1000 and 9999.
-        Account* newAccount = new Account(accountNumber, name, initialBalance, password); // Creates a new account object with the provided details.
-        accountTree.addAccount(newAccount); // Adds the new account to the binary tree.
-        cout << "\nAccount created successfully! Your account number is " << accountNumber << ".\n"; // Confirms account creation and displays account number.
+        Account* newAccount = openAccount(name, initialBalance, password); // Creates the account and adds it to the system.
+        cout << "\nAccount created successfully! Your account number is " << newAccount->accountNumber << ".\n"; // Confirms account creation and displays account number.
     }
 
     void login() { // Handles user login process.
@@ -373,7 +1331,7 @@ public:
         cin >> enteredPassword; // Reads password input.
         if (acc->validatePassword(enteredPassword)) { // Validates the entered password.
             cout << "Login successful!\n"; // Confirms successful login.
-            currentUser  = acc; // Sets the current user to the logged-in account.
+            logIn(acc); // Sets the current user to the logged-in account.
             menu(); // Calls the menu function to display user options.
         } else {
             cout << "Incorrect password. Please try again.\n"; // Notifies user of incorrect password.
@@ -400,7 +1358,11 @@ public:
             cout << "1. View All Accounts \n"; // Option to view all accounts.
             cout << "2. Search Account \n"; // Option to search for a specific account.
             cout << "3. View Loan History\n"; // Option to view loan history of accounts.
-            cout << "4. Logout\n"; // Option to log out of the admin menu.
+            cout << "4. View Storage Statistics\n"; // Option to view account residency and hit/miss counters.
+            cout << "5. Search by Customer Name\n"; // Option to search accounts by name prefix or close spelling.
+            cout << "6. Review Flagged Transactions (" << pendingReviews << " pending)\n"; // Option to review transactions flagged by the fraud detector.
+            cout << "7. Audit Log\n"; // Option to export or replay the transaction audit log.
+            cout << "8. Logout\n"; // Option to log out of the admin menu.
             cout << "Enter your choice: "; // Prompts for admin choice.
             cin >> choice; // Reads the admin's choice.
             switch (choice) { // Switch statement to handle admin menu options.
@@ -460,12 +1422,152 @@ public:
                     break;
                 }
                 case 4:
+                    accountTree.displayStorageStatistics(); // Displays account residency and hit/miss counters.
+                    break;
+                case 5:
+                    searchByName(); // Searches accounts by name prefix or close spelling.
+                    break;
+                case 6:
+                    reviewFlaggedTransactions(); // Displays and clears the review queue.
+                    break;
+                case 7: {
+                    int subChoice; // Variable to store sub-choice for the audit log.
+                    string path; // Variable to store the audit log file name.
+                    cout << "\n--- Audit Log ---\n"; // Header for audit log options.
+                    cout << "1. Export Audit Log\n"; // Option to write all transactions to a file.
+                    cout << "2. Replay and Reconcile Audit Log\n"; // Option to rebuild balances from a file and compare them.
+                    cout << "Enter your choice: "; // Prompts for sub-choice.
+                    cin >> subChoice; // Reads the sub-choice.
+                    if (subChoice == 1 || subChoice == 2) { // Both options need a file name.
+                        cout << "Enter audit log file name: "; // Prompts for the file name.
+                        cin >> path; // Reads the file name.
+                    }
+                    if (subChoice == 1) { // If admin chooses to export.
+                        exportAuditLog(path); // Writes the audit log.
+                    } else if (subChoice == 2) { // If admin chooses to replay.
+                        replayAuditLog(path); // Replays and reconciles the audit log.
+                    } else {
+                        cout << "Invalid choice. Please try again.\n"; // Notifies if invalid choice is made.
+                    }
+                    break;
+                }
+                case 8:
                     cout << "Logging out...\n"; // Notifies admin of logout.
                     break;
                 default:
                     cout << "Invalid choice. Please try again.\n"; // Notifies if invalid choice is made.
             }
-        } while (choice != 4); // Repeats until admin chooses to log out.
+        } while (choice != 8); // Repeats until admin chooses to log out.
+    }
+
+    void searchByName() { // Handles the admin search by customer name.
+        string query; // Variable to store the name or name prefix.
+        cout << "Enter customer name or prefix: "; // Prompts for the search text.
+        cin.ignore(); // Clears the input buffer.
+        getline(cin, query); // Reads the full query including spaces.
+        vector<NameMatch> matches = accountTree.searchByName(query, NAME_SEARCH_LIMIT); // Finds the best matches.
+        if (matches.empty()) { // Checks if nothing matched.
+            cout << "No matching accounts found.\n"; // Notifies the admin.
+            return; // Exits the function.
+        }
+        cout << "\n--- Matching Accounts ---\n"; // Header for search results.
+        for (size_t i = 0; i < matches.size(); ++i) { // Loops through the ranked matches.
+            cout << i + 1 << ". Account Number: " << matches[i].node->accountNumber // Displays the rank and account number.
+                 << ", Customer Name: " << matches[i].node->customerName // Displays the customer name.
+                 << (matches[i].distance == 0 ? "" : " (close match)") << "\n"; // Marks matches that needed a spelling correction.
+        }
+    }
+
+    void reviewFlaggedTransactions() { // Displays flagged transactions and removes them from the review queue.
+        if (reviewQueue.empty()) { // Checks if nothing is waiting.
+            cout << "No flagged transactions to review.\n"; // Notifies the admin.
+            return; // Exits the function.
+        }
+        cout << "\n--- Flagged Transactions ---\n"; // Header for the review list.
+        while (!reviewQueue.empty()) { // Loops until the queue is empty.
+            cout << describeFlagged(reviewQueue.front()) << "\n"; // Displays the oldest flagged transaction.
+            reviewQueue.dequeue(); // Removes it from the queue.
+        }
+        cout << pendingReviews << " flagged transaction(s) reviewed.\n"; // Confirms the queue was cleared.
+        pendingReviews = 0; // Resets the pending count.
+    }
+
+    static string describeFlagged(const FlaggedTransaction& flagged) { // Formats a flagged transaction for review.
+        char buffer[80]; // Buffer to hold the formatted time string.
+        strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", localtime(&flagged.flaggedAt)); // Formats the flag time.
+        ostringstream out; // Stream used for formatting.
+        out << buffer << " - Account Number: " << flagged.accountNumber // Time and account number.
+            << ", Customer Name: " << flagged.customerName // Customer name.
+            << ", " << flagged.type << ": " << flagged.amount // Transaction.
+            << ", Reason: " << FraudDetector::describeFlags(flagged.flags); // Why it was flagged.
+        return out.str(); // Returns the text.
+    }
+
+    bool writeAuditLog(const string& path, AuditLogWriter& writer) { // Adds every account to the writer and writes the file.
+        CustomQueue<AccountNode*> q; // Creates a queue to traverse the account binary tree.
+        AccountNode* root = accountTree.getRoot(); // Gets the root of the account binary tree.
+        if (root) q.enqueue(root); // Enqueues the root node for traversal.
+        while (!q.empty()) { // Loops until all nodes are processed.
+            AccountNode* current = q.front(); // Gets the front node from the queue.
+            q.dequeue(); // Dequeues the front node.
+            Account scratch; // Holds the account if it has to be read from disk.
+            Account* acc = accountTree.scanAccount(current, scratch); // Reads the account without changing its residency.
+            if (!acc) return false; // An account that cannot be read would leave the log incomplete.
+            writer.addAccount(*acc); // Adds the account.
+            if (current->left) q.enqueue(current->left); // Enqueues the left child if it exists.
+            if (current->right) q.enqueue(current->right); // Enqueues the right child if it exists.
+        }
+        return writer.writeFile(path); // Writes the file.
+    }
+
+    void exportAuditLog(const string& path) { // Writes every account's transactions to an audit log file.
+        AuditLogWriter writer; // Collects the columns.
+        if (writeAuditLog(path, writer)) { // Writes the file.
+            cout << "Exported " << writer.getTransactionCount() << " transactions from " << writer.getAccountCount() << " accounts to " << path << ".\n"; // Confirms the export.
+        } else {
+            cout << "Failed to write audit log to " << path << ".\n"; // Notifies the admin of the failure.
+        }
+    }
+
+    vector<string> reconcileAuditLog(const string& path, size_t& accounts, size_t& transactions) { // Replays a log against the live accounts and returns one line per mismatch; throws on a bad file.
+        vector<ReplayedAccount> replayed = AuditLogReplayer::replay(path); // Replays the file.
+        vector<string> mismatches; // Accounts that do not reconcile.
+        accounts = replayed.size(); // Number of accounts replayed.
+        transactions = 0; // Number of transactions replayed.
+        for (size_t i = 0; i < replayed.size(); ++i) { // Compares each replayed account with the live one.
+            transactions += replayed[i].transactionCount; // Counts the replayed transactions.
+            AccountNode* node = accountTree.findNode(replayed[i].accountNumber); // Finds the live account.
+            Account scratch; // Holds the account if it has to be read from disk.
+            Account* acc = node ? accountTree.scanAccount(node, scratch) : nullptr; // Reads it without changing its residency.
+            ostringstream line; // Description of a mismatch.
+            if (!node) { // The account is in the log but not in the system.
+                line << "Account " << replayed[i].accountNumber << " (" << replayed[i].customerName << ") is missing.";
+                mismatches.push_back(line.str());
+            } else if (!acc) { // The account exists but its record cannot be read.
+                line << "Account " << replayed[i].accountNumber << " (" << replayed[i].customerName << ") is unavailable.";
+                mismatches.push_back(line.str());
+            } else if (acc->balance != replayed[i].balance || acc->loanAmount != replayed[i].loanAmount) { // Replay applies the same operations in the same order, so the results match exactly.
+                line << "Account " << acc->accountNumber << " (" << acc->customerName << ") does not reconcile: " // Describes the difference.
+                     << "replayed balance " << replayed[i].balance << ", live balance " << acc->balance
+                     << ", replayed loan " << replayed[i].loanAmount << ", live loan " << acc->loanAmount;
+                mismatches.push_back(line.str());
+            }
+        }
+        return mismatches; // Returns the mismatches.
+    }
+
+    void replayAuditLog(const string& path) { // Rebuilds balances from an audit log and compares them with the live accounts.
+        vector<string> mismatches; // Accounts that do not reconcile.
+        size_t accounts = 0, transactions = 0; // Replay totals.
+        try {
+            mismatches = reconcileAuditLog(path, accounts, transactions); // Replays and compares.
+        } catch (const exception& e) { // Also covers allocation failures on a damaged file.
+            cout << "Replay failed: " << e.what() << "\n"; // Notifies the admin of a bad file.
+            return; // Exits the function.
+        }
+        for (size_t i = 0; i < mismatches.size(); ++i) cout << mismatches[i] << "\n"; // Displays each mismatch.
+        cout << "Replayed " << transactions << " transactions for " << accounts << " accounts; " // Summarizes the replay.
+             << mismatches.size() << " account(s) did not reconcile.\n";
     }
 
     void deposit() { // Handles deposit process for the current user.
@@ -491,8 +1593,7 @@ public:
             cin.clear(); // Clears the error state.
             cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Ignores invalid input.
         }
-        currentUser ->balance += amount; // Updates the current user's balance with the deposit amount.
-        currentUser ->addTransaction("Deposit: " + to_string(amount)); // Adds a transaction record for the deposit.
+        applyDeposit(currentUser, amount); // Updates the current user's balance with the deposit amount.
         cout << "Deposited " << amount << " to account " << accountNumber << ".\n"; // Confirms the deposit.
         cout << "Current balance: " << currentUser ->balance << ".\n"; // Displays the updated balance.
     }
@@ -527,9 +1628,7 @@ public:
             cin.clear(); // Clears the error state.
             cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Ignores invalid input.
         }
-        if (currentUser ->balance >= amount) { // Checks if the current balance is sufficient for the withdrawal.
-            currentUser ->balance -= amount; // Deducts the withdrawal amount from the current balance.
-            currentUser ->addTransaction("Withdraw: " + to_string(amount)); // Adds a transaction record for the withdrawal.
+        if (applyWithdrawal(currentUser, amount)) { // Deducts the amount if the balance is sufficient.
             cout << "Withdrew " << amount << " from account " << accountNumber << ".\n"; // Confirms the withdrawal.
             cout << "Current balance: " << currentUser ->balance << ".\n"; // Displays the updated balance.
         } else {
@@ -546,13 +1645,6 @@ public:
         int accountNumber; // Variable to store account number.
         double loanAmount; // Variable to store requested loan amount.
         string reason; // Variable to store reason for the loan.
-        vector<string> loanReasons = { // Vector to store predefined loan reasons.
-            "Medical Emergency", // Reason option 1.
-            "Education", // Reason option 2.
-            "Home Renovation", // Reason option 3.
-            "Business Investment", // Reason option 4.
-            "Car Purchase" // Reason option 5.
-        };
 
         cout << "Enter account number: "; // Prompts for account number.
         while (!(cin >> accountNumber)) { // Validates input for account number.
@@ -576,19 +1668,19 @@ public:
         }
 
         cout << "Select a reason for the loan:\n"; // Prompts for loan reason selection.
-        for (size_t i = 0; i < loanReasons.size(); ++i) { // Loops through loan reasons.
-            cout << i + 1 << ". " << loanReasons[i] << endl; // Displays each loan reason with a corresponding number.
+        for (int i = 0; i < LOAN_REASON_COUNT; ++i) { // Loops through loan reasons.
+            cout << i + 1 << ". " << LOAN_REASONS[i] << endl; // Displays each loan reason with a corresponding number.
         }
 
         int reasonChoice; // Variable to store user's choice of loan reason.
         cout << "Enter the number corresponding to your reason: "; // Prompts for reason choice.
-        while (!(cin >> reasonChoice) || reasonChoice < 1 || reasonChoice > static_cast<int>(loanReasons.size())) { // Validates reason choice.
+        while (!(cin >> reasonChoice) || reasonChoice < 1 || reasonChoice > LOAN_REASON_COUNT) { // Validates reason choice.
             cout << "Invalid choice. Please select a valid option: "; // Prompts for valid input.
             cin.clear(); // Clears the error state.
             cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Ignores invalid input.
         }
 
-        reason = loanReasons[reasonChoice - 1]; // Sets the reason based on user's choice.
+        reason = LOAN_REASONS[reasonChoice - 1]; // Sets the reason based on user's choice.
 
         cout << "Enter loan amount: "; // Prompts for loan amount.
         while (!(cin >> loanAmount)) { // Validates input for loan amount.
@@ -598,22 +1690,9 @@ public:
         }
 
         // Loan approval logic
-        if (currentUser ->balance < 50000 && loanAmount <= 100000) { // Checks if balance is less than 50,000 and loan amount is within limit.
-            currentUser ->loanAmount = loanAmount; // Sets the loan amount for the current user.
-            currentUser ->loanReason = reason; // Sets the loan reason for the current user.
-            currentUser ->loanPending = true; // Marks the loan as pending.
-
-            // Add loan to loan history
-            currentUser ->loanHistory.addLoan(loanAmount, reason, currentUser ->customerName, currentUser ->accountNumber); // Adds the loan details to the user's loan history.
+        if (loanWithinLimit(currentUser, loanAmount)) { // Checks if the loan amount is within the limit for the balance range.
+            currentUser ->requestLoan(loanAmount, reason); // Records the loan, its history entry and its transaction on the account.
             cout << "Loan approved for " << loanAmount << " with reason: " << reason << ".\n"; // Confirms loan approval.
-        } else if (currentUser ->balance >= 50000 && currentUser ->balance <= 100000 && loanAmount <= 8000) { // Checks if balance is between 50,000 and 100,000 and loan amount is within limit.
-            currentUser ->loanAmount = loanAmount; // Sets the loan amount for the current user.
-            currentUser ->loanReason = reason; // Sets the loan reason for the current user.
-            currentUser ->loanPending = true; // Marks the loan as pending.
-
-            // Add loan to loan history
-            currentUser ->loanHistory.addLoan(loanAmount, reason, currentUser ->customerName, currentUser ->accountNumber); // Adds the loan details to the user's loan history.
-            cout << "Loan request approved for " << loanAmount << " with reason: " << reason << ".\n"; // Confirms loan approval.
         } else {
             cout << "Loan request denied. Reason: Requested amount exceeds the allowed limit for your balance range.\n"; // Notifies user of loan denial.
         }
@@ -639,12 +1718,16 @@ public:
         while (!q.empty()) { // Loops until all nodes are processed.
             AccountNode* current = q.front(); // Gets the front node from the queue.
             q.dequeue(); // Dequeues the front node.
-            if (current && current->account) { // Checks if the current node and account are valid.
-                string loanDetails = current->account->getLoanDetails(); // Retrieves loan details for the current account.
-                cout << "Account Number: " << current->account->accountNumber << "\n"; // Displays account number.
-                cout << "Customer Name: " << current->account->customerName << "\n"; // Displays customer name.
-                cout << "Loan Details: " << loanDetails << "\n"; // Displays loan details.
-                cout << "---------------------------------------\n"; // Separator line for clarity.
+            if (current) { // Checks if the current node is valid.
+                Account scratch; // Holds the account if it has to be read from disk.
+                Account* acc = accountTree.scanAccount(current, scratch); // Reads the account without changing its residency.
+                if (acc) { // Skips an account that cannot be read.
+                    string loanDetails = acc->getLoanDetails(); // Retrieves loan details for the current account.
+                    cout << "Account Number: " << acc->accountNumber << "\n"; // Displays account number.
+                    cout << "Customer Name: " << acc->customerName << "\n"; // Displays customer name.
+                    cout << "Loan Details: " << loanDetails << "\n"; // Displays loan details.
+                    cout << "---------------------------------------\n"; // Separator line for clarity.
+                }
             }
             if (current->left) q.enqueue(current->left); // Enqueues the left child if it exists.
             if (current->right) q.enqueue(current->right); // Enqueues the right child if it exists.
@@ -695,7 +1778,7 @@ public:
                     currentUser ->viewTransactionHistory(); // Calls the viewTransactionHistory function to display transaction history.
                     break; // Ends case 6.
                 case 7:
-                    currentUser  = nullptr; // Logs out the current user by setting currentUser  to nullptr.
+                    logOut(); // Logs out the current user.
                     cout << "\n*****LOGOUT SUCCESSFUL*****\n"; // Confirms successful logout.
                     break; // Ends case 7.
                 default:
@@ -704,29 +1787,283 @@ public:
         } while (choice != 7); // Repeats until the user chooses to log out.
     }
 
+    void runCommandProtocol(bool binaryFraming) { // Reads pipelined commands from standard input and answers each batch in one write.
+        bool running = true; // Cleared by the QUIT command.
+        string command; // Current command text.
+        protocolBroken = false; // Set by readCommand on a framing error.
+        while (running && !protocolBroken) { // Processes one batch per pass.
+            vector<string> batch; // Commands read ahead before any response is written.
+            while (batch.size() < PROTOCOL_BATCH_LIMIT && (batch.empty() || cin.rdbuf()->in_avail() > 0) // Waits for the first command, then takes every command already waiting.
+                   && readCommand(command, binaryFraming)) {
+                batch.push_back(command);
+            }
+            if (batch.empty() && !protocolBroken) break; // End of input.
+            string responses; // All responses of the batch, written together.
+            for (size_t i = 0; i < batch.size() && running; ++i) { // Executes the commands in order.
+                string response = executeCommand(batch[i], running); // Runs one command.
+                if (binaryFraming) { // Every frame gets a response frame.
+                    if (response.empty()) response = "ERR empty command"; // Keeps requests and responses paired.
+                    appendFrame(responses, response);
+                } else if (!response.empty()) { // Blank lines get no response.
+                    responses += response + "\n";
+                }
+            }
+            if (protocolBroken && running) appendFrame(responses, "ERR frame too large"); // Explains why the session ends.
+            cout.write(responses.data(), responses.size()); // Writes the whole batch at once.
+            cout.flush(); // Sends it to the client.
+        }
+        logOut(); // Releases the session's account.
+    }
+
 private:
-    Account* findAccountByName(const string& name) { // Finds an account by customer name.
-        CustomQueue<AccountNode*> q; // Creates a queue to traverse the account binary tree.
-        AccountNode* root = accountTree.getRoot(); // Gets the root of the account binary tree.
-        if (root) q.enqueue(root); // Enqueues the root node for traversal.
-        while (!q.empty()) { // Loops until all nodes are processed.
-            AccountNode* current = q.front(); // Gets the front node from the queue.
-            q.dequeue(); // Dequeues the front node.
-            if (current && current->account && current->account->customerName == name) { // Checks if the current node and account are valid and if the name matches.
-                return current->account; // Returns the found account.
+    bool readCommand(string& command, bool binaryFraming) { // Reads one command line or frame, returning false at end of input.
+        if (!binaryFraming) { // Text commands are one per line.
+            if (!getline(cin, command)) return false; // Stops at end of input.
+            if (!command.empty() && command[command.size() - 1] == '\r') command.erase(command.size() - 1); // Accepts Windows line endings.
+            return true; // A line was read.
+        }
+        unsigned char header[4]; // Big-endian payload length.
+        if (!cin.read(reinterpret_cast<char*>(header), sizeof(header))) return false; // Stops at end of input.
+        unsigned long length = (static_cast<unsigned long>(header[0]) << 24) | (static_cast<unsigned long>(header[1]) << 16) // Decodes the length.
+                             | (static_cast<unsigned long>(header[2]) << 8) | header[3];
+        if (length > PROTOCOL_MAX_FRAME) { // The payload is not read, so the stream can no longer be trusted.
+            protocolBroken = true; // Ends the session after the current batch.
+            return false;
+        }
+        command.assign(length, '\0'); // Allocates the payload.
+        return length == 0 || static_cast<bool>(cin.read(&command[0], length)); // Reads the payload.
+    }
+
+    static void appendFrame(string& out, const string& payload) { // Appends a payload with its big-endian length prefix.
+        unsigned long length = payload.size(); // Payload length.
+        out.push_back(static_cast<char>((length >> 24) & 0xFF)); // Writes the length, most significant byte first.
+        out.push_back(static_cast<char>((length >> 16) & 0xFF));
+        out.push_back(static_cast<char>((length >> 8) & 0xFF));
+        out.push_back(static_cast<char>(length & 0xFF));
+        out += payload; // Writes the payload.
+    }
+
+    static string formatAmount(double amount) { // Formats an amount with two decimal places.
+        ostringstream out; // Stream used for formatting.
+        out << fixed << setprecision(2) << amount; // Formats the amount.
+        return out.str(); // Returns the text.
+    }
+
+    static string restOfLine(istream& in) { // Returns the remaining words of a command, such as a name with spaces.
+        string rest; // Remaining text.
+        getline(in >> ws, rest); // Skips leading spaces and reads to the end.
+        return rest; // Returns the text.
+    }
+
+    static string describeAccount(const Account* acc) { // Formats an account for a protocol response.
+        return "account=" + to_string(acc->accountNumber) + " balance=" + formatAmount(acc->balance) // Account number and balance.
+             + " loan=" + formatAmount(acc->loanAmount) + " name=" + acc->customerName; // Loan and name, which may contain spaces.
+    }
+
+    string executeCommand(const string& line, bool& running) { // Executes one protocol command and returns its one-line response.
+        istringstream args(line); // Splits the command into words.
+        string verb; // Command name.
+        if (!(args >> verb)) return ""; // Blank commands get no response.
+        for (size_t i = 0; i < verb.size(); ++i) verb[i] = static_cast<char>(toupper(static_cast<unsigned char>(verb[i]))); // Command names ignore case.
+
+        if (verb == "PING") return "OK PONG"; // Lets clients check the connection.
+        if (verb == "QUIT") { // Ends the session.
+            running = false;
+            return "OK BYE";
+        }
+        if (verb == "SIGNUP") { // SIGNUP <password> <initial balance> <name>
+            string password; // Password of the new account.
+            double initialBalance; // Opening balance.
+            if (!(args >> password >> initialBalance)) return "ERR usage: SIGNUP <password> <initial balance> <name>";
+            string name = restOfLine(args); // Name may contain spaces.
+            if (name.empty()) return "ERR usage: SIGNUP <password> <initial balance> <name>";
+            if (password.length() < 5 || password.length() > 8) return "ERR password must be between 5 and 8 characters long";
+            if (findAccountByName(name)) return "ERR an account with this name already exists";
+            return "OK " + to_string(openAccount(name, initialBalance, password)->accountNumber); // Returns the new account number.
+        }
+        if (verb == "LOGIN") { // LOGIN <password> <name>
+            string password; // Entered password.
+            if (!(args >> password)) return "ERR usage: LOGIN <password> <name>";
+            Account* acc = findAccountByName(restOfLine(args)); // Finds the account by name.
+            if (!acc || !acc->validatePassword(password)) return "ERR incorrect name or password";
+            logIn(acc); // Makes it the current user.
+            return "OK " + to_string(acc->accountNumber); // Returns the account number.
+        }
+        if (verb == "LOGOUT") { // Ends both user and admin access.
+            logOut();
+            adminSession = false;
+            return "OK";
+        }
+        if (verb == "ADMIN") { // ADMIN <password>
+            string password; // Entered admin password.
+            args >> password;
+            if (password != adminPassword) return "ERR incorrect admin password";
+            adminSession = true; // Enables admin commands.
+            return "OK";
+        }
+        bool adminCommand = verb == "FIND" || verb == "SEARCH" || verb == "ACCOUNTS" || verb == "LOANS" // Commands that need ADMIN first.
+                         || verb == "STATS" || verb == "REVIEW" || verb == "AUDIT";
+        if (adminCommand) {
+            if (!adminSession) return "ERR admin login required";
+            return executeAdminCommand(verb, args); // Runs the admin command.
+        }
+
+        bool accountCommand = verb == "INFO" || verb == "HISTORY" || verb == "DEPOSIT" || verb == "WITHDRAW" || verb == "LOAN"; // Commands on the logged-in account.
+        if (!accountCommand) return "ERR unknown command " + verb;
+        if (!currentUser ) return "ERR please log in first";
+        if (verb == "INFO") return "OK " + describeAccount(currentUser ); // INFO
+        if (verb == "HISTORY") { // HISTORY, newest transaction first as in the menu.
+            vector<string> entries; // Transaction history entries.
+            for (int i = currentUser ->transactionHistory.size() - 1; i >= 0; --i) entries.push_back(currentUser ->transactionHistory.at(i));
+            return listResponse(entries);
+        }
+
+        int accountNumber; // Account named in the command.
+        if (!(args >> accountNumber)) return "ERR account number required";
+        if (accountNumber != currentUser ->accountNumber) return "ERR you can only use your own account";
+        if (verb == "DEPOSIT") { // DEPOSIT <account number> <amount>
+            double amount; // Deposit amount.
+            if (!(args >> amount) || amount <= 100) return "ERR amount must be greater than 100";
+            applyDeposit(currentUser, amount); // Adds the deposit.
+            return "OK " + formatAmount(currentUser ->balance); // Returns the new balance.
+        }
+        string password; // Password required for withdrawals and loans.
+        if (!(args >> password) || !currentUser ->validatePassword(password)) return "ERR incorrect password";
+        if (verb == "WITHDRAW") { // WITHDRAW <account number> <password> <amount>
+            double amount; // Withdrawal amount.
+            if (!(args >> amount) || amount <= 100) return "ERR amount must be greater than 100";
+            if (!applyWithdrawal(currentUser, amount)) return "ERR insufficient funds";
+            return "OK " + formatAmount(currentUser ->balance); // Returns the new balance.
+        }
+        int reasonChoice; // LOAN <account number> <password> <reason number> <amount>
+        double loanAmount; // Requested loan amount.
+        if (!(args >> reasonChoice >> loanAmount) || reasonChoice < 1 || reasonChoice > LOAN_REASON_COUNT) {
+            return "ERR usage: LOAN <account number> <password> <reason 1-" + to_string(LOAN_REASON_COUNT) + "> <amount>";
+        }
+        if (!loanWithinLimit(currentUser, loanAmount)) return "ERR requested amount exceeds the allowed limit for your balance range";
+        currentUser ->requestLoan(loanAmount, LOAN_REASONS[reasonChoice - 1]); // Records the loan.
+        return "OK " + formatAmount(loanAmount); // Returns the approved amount.
+    }
+
+    static string joinItems(const vector<string>& items) { // Joins items with bars, escaping bars and backslashes inside them as \| and \\.
+        string joined; // Joined items.
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (i > 0) joined += '|'; // Separates the items.
+            for (size_t j = 0; j < items[i].size(); ++j) { // Copies the item, escaping the delimiter.
+                if (items[i][j] == '|' || items[i][j] == '\\') joined += '\\';
+                joined += items[i][j];
             }
-            if (current && current->left) q.enqueue(current->left); // Enqueues the left child if it exists.
-            if (current && current->right) q.enqueue(current->right); // Enqueues the right child if it exists.
         }
-        return nullptr; // Returns nullptr if no account is found with the given name.
+        return joined; // Returns the joined text.
+    }
+
+    static string listResponse(const vector<string>& items) { // Formats a list as "OK <count> item|item|...".
+        string response = "OK " + to_string(items.size()); // Number of items.
+        if (!items.empty()) response += " " + joinItems(items); // Items separated by bars.
+        return response; // Returns the one-line response.
+    }
+
+    string executeAdminCommand(const string& verb, istream& args) { // Executes a protocol command that needs admin access.
+        if (verb == "FIND") { // FIND <account number>
+            int accountNumber; // Account to find.
+            if (!(args >> accountNumber)) return "ERR usage: FIND <account number>";
+            Account* acc = findAccountByNumber(accountNumber); // Finds the account by number.
+            return acc ? "OK " + describeAccount(acc) : "ERR account not found";
+        }
+        if (verb == "SEARCH") { // SEARCH <name or prefix>
+            vector<NameMatch> matches = accountTree.searchByName(restOfLine(args), NAME_SEARCH_LIMIT); // Finds the best matches.
+            vector<string> items; // Account number and name of each match.
+            for (size_t i = 0; i < matches.size(); ++i) items.push_back(to_string(matches[i].node->accountNumber) + " " + matches[i].node->customerName);
+            return listResponse(items);
+        }
+        if (verb == "ACCOUNTS" || verb == "LOANS") { // ACCOUNTS, LOANS, or LOANS <account number>
+            int accountNumber; // Account whose loan history is wanted.
+            vector<string> items; // One entry per account or loan.
+            if (verb == "LOANS" && args >> accountNumber) { // Loan history of one account.
+                Account* acc = findAccountByNumber(accountNumber); // Finds the account by number.
+                if (!acc) return "ERR account not found";
+                for (LoanNode* loan = acc->loanHistory.getHead(); loan; loan = loan->next) { // Walks the loan history.
+                    items.push_back("amount=" + formatAmount(loan->amount) + " reason=" + loan->reason);
+                }
+                return listResponse(items);
+            }
+            vector<AccountNode*> nodes; // Every account sorted by account number.
+            accountTree.collectInOrder(accountTree.getRoot(), nodes);
+            for (size_t i = 0; i < nodes.size(); ++i) { // Formats each account without changing its residency.
+                Account scratch; // Holds the account if it has to be read from disk.
+                Account* acc = accountTree.scanAccount(nodes[i], scratch);
+                if (!acc) return "ERR account " + to_string(nodes[i]->accountNumber) + " is unavailable";
+                items.push_back(verb == "ACCOUNTS" ? describeAccount(acc) // Account summary.
+                    : "account=" + to_string(acc->accountNumber) + " loan=" + formatAmount(acc->loanAmount) + " reason=" + acc->loanReason); // Current loan.
+            }
+            return listResponse(items);
+        }
+        if (verb == "STATS") return "OK " + accountTree.storageSummary(); // STATS
+        if (verb == "REVIEW") { // REVIEW empties the review queue like the admin menu.
+            vector<string> items; // Flagged transactions, oldest first.
+            while (!reviewQueue.empty()) {
+                items.push_back(describeFlagged(reviewQueue.front()));
+                reviewQueue.dequeue();
+            }
+            pendingReviews = 0; // Resets the pending count.
+            return listResponse(items);
+        }
+        string action; // AUDIT EXPORT <path> or AUDIT REPLAY <path>
+        args >> action;
+        for (size_t i = 0; i < action.size(); ++i) action[i] = static_cast<char>(toupper(static_cast<unsigned char>(action[i]))); // Ignores case like the verb.
+        string path = restOfLine(args); // File name, which may contain spaces.
+        if ((action != "EXPORT" && action != "REPLAY") || path.empty()) return "ERR usage: AUDIT EXPORT|REPLAY <path>";
+        if (action == "EXPORT") {
+            AuditLogWriter writer; // Collects the columns.
+            if (!writeAuditLog(path, writer)) return "ERR failed to write audit log to " + path;
+            return "OK accounts=" + to_string(writer.getAccountCount()) + " transactions=" + to_string(writer.getTransactionCount());
+        }
+        size_t accounts = 0, transactions = 0; // Replay totals.
+        vector<string> mismatches; // Accounts that do not reconcile.
+        try {
+            mismatches = reconcileAuditLog(path, accounts, transactions); // Replays and compares.
+        } catch (const exception& e) {
+            return string("ERR replay failed: ") + e.what(); // Reports a bad file.
+        }
+        string response = "OK accounts=" + to_string(accounts) + " transactions=" + to_string(transactions) + " mismatches=" + to_string(mismatches.size()); // Totals first.
+        if (!mismatches.empty()) response += " " + joinItems(mismatches); // Then each mismatch.
+        return response;
+    }
+
+    Account* findAccountByName(const string& name) { // Finds an account by customer name.
+        return accountTree.findAccountByName(name); // Calls the findAccountByName method of the binary tree.
     }
 };
 
-int main() { // Main function where the program execution starts.
-    cout << "Starting Bank Management System..." << endl;
+int main(int argc, char* argv[]) { // Main function where the program execution starts.
     srand(static_cast<unsigned>(time(0))); // Seeds the random number generator with the current time.
+    size_t memoryBudget = DEFAULT_MEMORY_BUDGET; // Bytes of account data kept in memory.
+    string segmentPath; // File for accounts evicted from memory, unique per run unless given.
+    bool protocolMode = false; // Whether to read commands instead of showing menus.
+    bool binaryFraming = false; // Whether protocol commands use length-prefixed frames.
+    for (int i = 1; i < argc; ++i) { // Reads command-line options.
+        string option = argv[i]; // Current option.
+        if (option == "--memory-budget" && i + 1 < argc) { // Sets the memory budget in bytes.
+            memoryBudget = strtoul(argv[++i], nullptr, 10); // Parses the budget value.
+        } else if (option == "--segment-path" && i + 1 < argc) { // Sets the file for evicted accounts.
+            segmentPath = argv[++i];
+        } else if (option == "--protocol") { // Uses the line-oriented command protocol.
+            protocolMode = true;
+        } else if (option == "--protocol-binary") { // Uses the command protocol with binary framing.
+            protocolMode = true;
+            binaryFraming = true;
+        }
+    }
+    if (segmentPath.empty()) segmentPath = uniqueSegmentPath(); // Keeps concurrent instances from sharing a segment.
+    if (protocolMode) { // Scripted clients get only command responses on standard output.
+        ios::sync_with_stdio(false); // Lets cin buffer ahead so pipelined commands can be read in batches.
+        BankManagementSystem bms(memoryBudget, segmentPath); // Creates an instance of the BankManagementSystem class.
+        bms.runCommandProtocol(binaryFraming); // Processes commands until QUIT or end of input.
+        return 0; // Returns 0 to indicate successful program termination.
+    }
+    cout << "Starting Bank Management System..." << endl;
     cout << "Creating BankManagementSystem object..." << endl;
-    BankManagementSystem bms; // Creates an instance of the BankManagementSystem class.
+    BankManagementSystem bms(memoryBudget, segmentPath); // Creates an instance of the BankManagementSystem class.
     cout << "Ready!" << endl;
     int choice; // Variable to store user's choice for the main menu.
     do {